@@ -12,17 +12,19 @@ public class DataTableGameplayTag : ModuleRules
 			new string[]
 			{
 				"Core",
+				"CoreUObject",
+				"DeveloperSettings",
+				"Engine",
+				"GameplayTags",
+				"NetCore",
 			}
 		);
 
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
-				"CoreUObject",
-				"Engine",
 				"Slate",
 				"SlateCore",
-				"GameplayTags",
 			}
 		);
 	}
@@ -1,6 +1,9 @@
 ﻿// Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "DataTableGameplayTag.h"
+#include "DataTableTagAssetTags.h"
+#include "DataTableTagRowData.h"
+#include "Misc/CoreDelegates.h"
 
 #define LOCTEXT_NAMESPACE "FDataTableGameplayTagModule"
 
@@ -8,10 +11,17 @@ DEFINE_LOG_CATEGORY(LogDataTableGameplayTag);
 
 void FDataTableGameplayTagModule::StartupModule()
 {
+#if WITH_EDITOR
+	FDataTableTagAssetTags::Register();
+#endif
+	FCoreDelegates::OnPostEngineInit.AddStatic(&FDataTableTagRowDataBinding::ValidateAll);
 }
 
 void FDataTableGameplayTagModule::ShutdownModule()
 {
+#if WITH_EDITOR
+	FDataTableTagAssetTags::Unregister();
+#endif
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -2,6 +2,7 @@
 
 #include "DataTableGameplayTagFunctionLibrary.h"
 #include "DataTableGameplayTag.h"
+#include "DataTableTagIndex.h"
 #include "GameplayTagsManager.h"
 
 #define LOCTEXT_NAMESPACE "DataTableGameplayTagFunctionLibrary"
@@ -43,7 +44,8 @@ bool UDataTableGameplayTagFunctionLibrary::Generic_GetDataTableRowFromName(const
 
 	if (OutRowPtr && Table)
 	{
-		const void* RowPtr = Table->FindRowUnchecked(RowName);
+		// The cached index uses the perfect hash cooked with the table; other threads keep to the row map
+		const void* RowPtr = IsInGameThread() ? FDataTableTagIndex::FindRow(*Table, RowName) : Table->FindRowUnchecked(RowName);
 
 		if (RowPtr != nullptr)
 		{
@@ -60,4 +62,64 @@ bool UDataTableGameplayTagFunctionLibrary::Generic_GetDataTableRowFromName(const
 	return bFoundRow;
 }
 
+bool UDataTableGameplayTagFunctionLibrary::GetGameplayTagDataTableRow(UGameplayTagDataTable* Table, FGameplayTag Tag, FTableRowBase& OutRow)
+{
+	// We should never hit this!  stubs to avoid NoExport on the class.
+	check(0);
+	return false;
+}
+
+bool UDataTableGameplayTagFunctionLibrary::Generic_GetGameplayTagDataTableRow(const UGameplayTagDataTable* Table, FGameplayTag Tag, void* OutRowPtr)
+{
+	const uint8* RowPtr = (OutRowPtr && Table) ? Table->FindRow(Tag) : nullptr;
+	if (!RowPtr)
+	{
+		return false;
+	}
+
+	Table->GetRowStruct()->CopyScriptStruct(OutRowPtr, RowPtr);
+	return true;
+}
+
+const uint8* UDataTableGameplayTagFunctionLibrary::FindRowByTagString(const UDataTable* Table, FStringView TagString)
+{
+	if (!Table || TagString.IsEmpty() || TagString.Len() >= NAME_SIZE)
+	{
+		return nullptr;
+	}
+
+	if (IsInGameThread())
+	{
+		return FDataTableTagIndex::FindRowByString(*Table, TagString);
+	}
+
+	// Other threads keep to the row map, with a name that is only found, never added
+	const FName RowName(TagString.Len(), TagString.GetData(), FNAME_Find);
+	return RowName.IsNone() ? nullptr : Table->FindRowUnchecked(RowName);
+}
+
+bool UDataTableGameplayTagFunctionLibrary::DataTableTagRowHandleHasRow(const FDataTableTagRowHandle& Handle)
+{
+	return Handle.Resolve() != nullptr;
+}
+
+bool UDataTableGameplayTagFunctionLibrary::GetDataTableRowFromHandle(const FDataTableTagRowHandle& Handle, FTableRowBase& OutRow)
+{
+	// We should never hit this!  stubs to avoid NoExport on the class.
+	check(0);
+	return false;
+}
+
+bool UDataTableGameplayTagFunctionLibrary::Generic_GetDataTableRowFromHandle(const FDataTableTagRowHandle& Handle, void* OutRowPtr)
+{
+	const uint8* RowPtr = Handle.Resolve();
+	if (!OutRowPtr || !RowPtr)
+	{
+		return false;
+	}
+
+	Handle.Table->GetRowStruct()->CopyScriptStruct(OutRowPtr, RowPtr);
+	return true;
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,17 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "DataTableGameplayTagSettings.h"
+#include "DataTableTagIndex.h"
+
+#if WITH_EDITOR
+void UDataTableGameplayTagSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Indices hold flattened rows only for the tables listed when they were built
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UDataTableGameplayTagSettings, InheritingTables))
+	{
+		FDataTableTagIndex::ResetCache();
+	}
+}
+#endif
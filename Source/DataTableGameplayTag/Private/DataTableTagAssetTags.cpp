@@ -0,0 +1,221 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "DataTableTagAssetTags.h"
+#include "AssetRegistry/AssetData.h"
+#include "DataTableTagIndex.h"
+#include "DataTableTagRowData.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagsManager.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+
+const FName FDataTableTagAssetTags::TagKeyed(TEXT("TagKeyed"));
+const FName FDataTableTagAssetTags::RowTags(TEXT("TagKeyedRows"));
+const FName FDataTableTagAssetTags::RowDataChecksum(TEXT("TagKeyedRowData"));
+
+namespace DataTableTagAssetTags
+{
+#if WITH_EDITOR
+	FDelegateHandle ExtraTagsHandle;
+	FDelegateHandle PostGarbageCollectHandle;
+
+	struct FCachedTags
+	{
+		TArray<UObject::FAssetRegistryTag> Tags;
+		FDelegateHandle ChangedHandle;
+	};
+
+	/**
+	 * Tags of each table since it last changed. The registry asks for the tags of loaded assets far more often
+	 * than they are saved, and computing them walks every row name. Game thread only.
+	 */
+	TMap<TObjectKey<UDataTable>, FCachedTags> Cache;
+
+	void OnTableChanged(TObjectKey<UDataTable> Key)
+	{
+		FCachedTags Cached;
+		if (Cache.RemoveAndCopyValue(Key, Cached))
+		{
+			if (UDataTable* Table = Key.ResolveObjectPtr())
+			{
+				Table->OnDataTableChanged().Remove(Cached.ChangedHandle);
+			}
+		}
+	}
+
+	void OnPostGarbageCollect()
+	{
+		for (auto It = Cache.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().ResolveObjectPtr())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	void ComputeTags(const UDataTable* Table, TArray<UObject::FAssetRegistryTag>& InOutTags)
+	{
+		// Well-formed rather than registered: registration changes without the asset being saved again
+		UGameplayTagsManager& Manager = UGameplayTagsManager::Get();
+		TArray<FName> RowNames;
+		Table->GetRowMap().GenerateKeyArray(RowNames);
+		const bool bTagKeyed = RowNames.Num() > 0 && !RowNames.ContainsByPredicate([&Manager](FName RowName)
+		{
+			return !Manager.IsValidGameplayTagString(RowName.ToString());
+		});
+
+		InOutTags.Add(UObject::FAssetRegistryTag(FDataTableTagAssetTags::TagKeyed, bTagKeyed ? TEXT("True") : TEXT("False"), UObject::FAssetRegistryTag::TT_Hidden));
+		if (bTagKeyed)
+		{
+			InOutTags.Add(UObject::FAssetRegistryTag(FDataTableTagAssetTags::RowTags, FDataTableTagAssetTags::EncodeRowNames(RowNames), UObject::FAssetRegistryTag::TT_Hidden));
+		}
+
+		// Hashing every value is only worth it for tables baked into code
+		if (bTagKeyed && FDataTableTagRowDataBinding::IsBound(*Table))
+		{
+			const FDataTableTagIndex Index(*Table);
+			InOutTags.Add(UObject::FAssetRegistryTag(FDataTableTagAssetTags::RowDataChecksum, FString::Printf(TEXT("%08x"), FDataTableTagRowDataBinding::ComputeChecksum(Index)), UObject::FAssetRegistryTag::TT_Hidden));
+		}
+	}
+
+	void AddTags(const UObject* Object, TArray<UObject::FAssetRegistryTag>& InOutTags)
+	{
+		const UDataTable* Table = Cast<UDataTable>(Object);
+		if (!Table || Table->HasAnyFlags(RF_ClassDefaultObject))
+		{
+			return;
+		}
+		if (!IsInGameThread())
+		{
+			ComputeTags(Table, InOutTags);
+			return;
+		}
+
+		const TObjectKey<UDataTable> Key(Table);
+		if (const FCachedTags* Cached = Cache.Find(Key))
+		{
+			InOutTags.Append(Cached->Tags);
+			return;
+		}
+
+		FCachedTags& Cached = Cache.Add(Key);
+		ComputeTags(Table, Cached.Tags);
+		// Imports, edits and undo all broadcast this after modifying the rows
+		Cached.ChangedHandle = const_cast<UDataTable*>(Table)->OnDataTableChanged().AddStatic(&OnTableChanged, Key);
+		InOutTags.Append(Cached.Tags);
+	}
+#endif
+}
+
+FString FDataTableTagAssetTags::EncodeRowNames(TConstArrayView<FName> RowNames)
+{
+	TArray<FString> Sorted;
+	Sorted.Reserve(RowNames.Num());
+	for (const FName RowName : RowNames)
+	{
+		Sorted.Add(RowName.ToString());
+	}
+	Sorted.Sort();
+
+	TStringBuilder<4096> Encoded;
+	FStringView Previous;
+	for (const FString& Name : Sorted)
+	{
+		int32 Shared = 0;
+		const int32 MaxShared = FMath::Min(Previous.Len(), Name.Len());
+		while (Shared < MaxShared && Previous[Shared] == Name[Shared])
+		{
+			++Shared;
+		}
+		if (Encoded.Len() > 0)
+		{
+			Encoded << TEXT(',');
+		}
+		Encoded << Shared << TEXT(':') << FStringView(Name).RightChop(Shared);
+		Previous = Name;
+	}
+	return Encoded.ToString();
+}
+
+void FDataTableTagAssetTags::DecodeRowNames(FStringView Encoded, TArray<FName>& OutRowNames)
+{
+	TStringBuilder<NAME_SIZE> Name;
+	while (!Encoded.IsEmpty())
+	{
+		int32 Comma = INDEX_NONE;
+		if (!Encoded.FindChar(TEXT(','), Comma))
+		{
+			Comma = Encoded.Len();
+		}
+		const FStringView Entry = Encoded.Left(Comma);
+		Encoded.RightChopInline(Comma + 1);
+
+		int32 Colon = INDEX_NONE;
+		if (!Entry.FindChar(TEXT(':'), Colon))
+		{
+			continue;
+		}
+		int32 Shared = 0;
+		LexFromString(Shared, Entry.Left(Colon));
+		Name.RemoveSuffix(Name.Len() - FMath::Clamp(Shared, 0, Name.Len()));
+		Name << Entry.RightChop(Colon + 1);
+		OutRowNames.Add(FName(Name.ToView()));
+	}
+}
+
+TOptional<bool> FDataTableTagAssetTags::IsTagKeyed(const FAssetData& Asset)
+{
+	FString Value;
+	if (!Asset.GetTagValue(TagKeyed, Value))
+	{
+		return {};
+	}
+	return Value == TEXT("True");
+}
+
+bool FDataTableTagAssetTags::GetRowNames(const FAssetData& Asset, TArray<FName>& OutRowNames)
+{
+	FString Encoded;
+	if (!Asset.GetTagValue(RowTags, Encoded) || Encoded.IsEmpty())
+	{
+		return false;
+	}
+	DecodeRowNames(Encoded, OutRowNames);
+	return true;
+}
+
+TOptional<uint32> FDataTableTagAssetTags::GetRowDataChecksum(const FAssetData& Asset)
+{
+	FString Value;
+	if (!Asset.GetTagValue(RowDataChecksum, Value) || Value.IsEmpty())
+	{
+		return {};
+	}
+	return FParse::HexNumber(*Value);
+}
+
+#if WITH_EDITOR
+void FDataTableTagAssetTags::Register()
+{
+	DataTableTagAssetTags::ExtraTagsHandle = UObject::FAssetRegistryTag::OnGetExtraObjectTags.AddStatic(&DataTableTagAssetTags::AddTags);
+	DataTableTagAssetTags::PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&DataTableTagAssetTags::OnPostGarbageCollect);
+}
+
+void FDataTableTagAssetTags::Unregister()
+{
+	UObject::FAssetRegistryTag::OnGetExtraObjectTags.Remove(DataTableTagAssetTags::ExtraTagsHandle);
+	DataTableTagAssetTags::ExtraTagsHandle.Reset();
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(DataTableTagAssetTags::PostGarbageCollectHandle);
+	DataTableTagAssetTags::PostGarbageCollectHandle.Reset();
+
+	for (const TPair<TObjectKey<UDataTable>, DataTableTagAssetTags::FCachedTags>& Pair : DataTableTagAssetTags::Cache)
+	{
+		if (UDataTable* Table = Pair.Key.ResolveObjectPtr())
+		{
+			Table->OnDataTableChanged().Remove(Pair.Value.ChangedHandle);
+		}
+	}
+	DataTableTagAssetTags::Cache.Empty();
+}
+#endif
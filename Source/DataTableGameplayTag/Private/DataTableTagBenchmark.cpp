@@ -0,0 +1,183 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "DataTableGameplayTag.h"
+#include "DataTableTagHash.h"
+#include "DataTableTagIndex.h"
+#include "DataTableTagScan.h"
+#include "Engine/DataTable.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace DataTableTagBenchmark
+{
+	/** Runs Lookup over every row name Iterations times in total and returns nanoseconds per lookup. */
+	template <typename LookupType>
+	double TimeLookups(TConstArrayView<FName> RowNames, int32 Iterations, LookupType Lookup, UPTRINT& InOutSink)
+	{
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			InOutSink ^= reinterpret_cast<UPTRINT>(Lookup(RowNames[Iteration % RowNames.Num()]));
+		}
+		return (FPlatformTime::Seconds() - Start) * 1e9 / Iterations;
+	}
+
+	void RunLookup(const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogDataTableGameplayTag, Display, TEXT("Usage: DataTableTag.BenchmarkLookup <TablePath> [Iterations=1000000]"));
+			return;
+		}
+
+		const UDataTable* Table = LoadObject<UDataTable>(nullptr, *Args[0]);
+		const int32 Iterations = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 1000000;
+		if (!Table || Table->GetRowMap().Num() == 0 || Iterations <= 0)
+		{
+			UE_LOG(LogDataTableGameplayTag, Error, TEXT("DataTableTag.BenchmarkLookup: cannot load %s, it has no rows, or the iteration count is invalid"), *Args[0]);
+			return;
+		}
+
+		TArray<FName> RowNames;
+		Table->GetRowMap().GenerateKeyArray(RowNames);
+
+		// Same hash as a cooked one, built here so uncooked tables can be measured too
+		TArray<uint64> Hashes;
+		for (const FName RowName : RowNames)
+		{
+			Hashes.Add(FTagPerfectHash::HashTag(RowName));
+		}
+		FTagPerfectHash PerfectHash;
+		if (!PerfectHash.Build(Hashes))
+		{
+			return;
+		}
+		TArray<int32> SlotToRow;
+		SlotToRow.SetNumUninitialized(RowNames.Num());
+		for (int32 Row = 0; Row < RowNames.Num(); ++Row)
+		{
+			SlotToRow[PerfectHash.SlotOf(Hashes[Row])] = Row;
+		}
+		TArray<const uint8*> Rows;
+		Table->GetRowMap().GenerateValueArray(Rows);
+
+		UPTRINT Sink = 0;
+		const double MapNs = TimeLookups(RowNames, Iterations, [Table](FName RowName) { return Table->FindRowUnchecked(RowName); }, Sink);
+		const double HashNs = TimeLookups(RowNames, Iterations, [&](FName RowName)
+		{
+			const int32 Row = SlotToRow[PerfectHash.SlotOf(FTagPerfectHash::HashTag(RowName))];
+			return RowNames[Row] == RowName ? Rows[Row] : nullptr;
+		}, Sink);
+		const double IndexNs = TimeLookups(RowNames, Iterations, [Table](FName RowName) { return FDataTableTagIndex::FindRow(*Table, RowName); }, Sink);
+
+		const SIZE_T HashBytes = PerfectHash.Seeds.GetAllocatedSize() + SlotToRow.GetAllocatedSize();
+		UE_LOG(LogDataTableGameplayTag, Display, TEXT("DataTableTag.BenchmarkLookup %s: %d rows, %d lookups (sink %llx)"), *Table->GetName(), RowNames.Num(), Iterations, static_cast<uint64>(Sink));
+		UE_LOG(LogDataTableGameplayTag, Display, TEXT("  FindRowUnchecked: %.1f ns/lookup, row map %llu bytes"), MapNs, static_cast<uint64>(Table->GetRowMap().GetAllocatedSize()));
+		UE_LOG(LogDataTableGameplayTag, Display, TEXT("  Perfect hash:     %.1f ns/lookup, %llu bytes"), HashNs, static_cast<uint64>(HashBytes));
+		UE_LOG(LogDataTableGameplayTag, Display, TEXT("  Cached index:     %.1f ns/lookup (%s)"), IndexNs, LexToString(FDataTableTagIndex::Get(*Table)->GetLookup()));
+	}
+
+	/**
+	 * Times scan, map and perfect hash over synthetic row sets of growing size, half of the lookups missing,
+	 * and reports the first size at which scanning loses; that is the value for DataTableTag.ScanThreshold.
+	 */
+	void RunStrategies(const TArray<FString>& Args)
+	{
+		const int32 MaxRows = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 4, 4096) : 256;
+		const int32 Iterations = 1000000;
+
+		TArray<FName> AllNames;
+		for (int32 Index = 0; Index < MaxRows * 2; ++Index)
+		{
+			AllNames.Add(FName(*FString::Printf(TEXT("Benchmark.Strategy.Row%d"), Index)));
+		}
+
+		UE_LOG(LogDataTableGameplayTag, Display, TEXT("DataTableTag.BenchmarkStrategies: ns/lookup, %d lookups per size"), Iterations);
+		UE_LOG(LogDataTableGameplayTag, Display, TEXT("  %6s %8s %8s %8s"), TEXT("Rows"), TEXT("Scan"), TEXT("Map"), TEXT("Hash"));
+
+		int32 Crossover = INDEX_NONE;
+		UPTRINT Sink = 0;
+		for (int32 NumRows = 4; NumRows <= MaxRows; NumRows *= 2)
+		{
+			const TConstArrayView<FName> RowNames(AllNames.GetData(), NumRows);
+			// Rows and as many names that are not rows, interleaved
+			TArray<FName> Probes;
+			for (int32 Index = 0; Index < NumRows; ++Index)
+			{
+				Probes.Add(AllNames[Index]);
+				Probes.Add(AllNames[NumRows + Index]);
+			}
+
+			TArray<uint32> Keys;
+			TMap<FName, int32> Map;
+			TArray<uint64> Hashes;
+			for (int32 Index = 0; Index < NumRows; ++Index)
+			{
+				Keys.Add(DataTableTagScan::MakeKey(RowNames[Index]));
+				Map.Add(RowNames[Index], Index);
+				Hashes.Add(FTagPerfectHash::HashTag(RowNames[Index]));
+			}
+			DataTableTagScan::Pad(Keys);
+			FTagPerfectHash PerfectHash;
+			if (!PerfectHash.Build(Hashes))
+			{
+				return;
+			}
+			TArray<int32> SlotToRow;
+			SlotToRow.SetNumUninitialized(NumRows);
+			for (int32 Index = 0; Index < NumRows; ++Index)
+			{
+				SlotToRow[PerfectHash.SlotOf(Hashes[Index])] = Index;
+			}
+
+			// Row index + 1 as a fake pointer, so a miss stays distinguishable in the sink
+			const double ScanNs = TimeLookups(Probes, Iterations, [&](FName Name)
+			{
+				const int32 Row = DataTableTagScan::Find(Keys.GetData(), Keys.Num(), DataTableTagScan::MakeKey(Name),
+					[&](int32 Index) { return Index < NumRows && RowNames[Index] == Name; });
+				return reinterpret_cast<const void*>(static_cast<UPTRINT>(Row + 1));
+			}, Sink);
+			const double MapNs = TimeLookups(Probes, Iterations, [&](FName Name)
+			{
+				const int32* Row = Map.Find(Name);
+				return reinterpret_cast<const void*>(static_cast<UPTRINT>(Row ? *Row + 1 : 0));
+			}, Sink);
+			const double HashNs = TimeLookups(Probes, Iterations, [&](FName Name)
+			{
+				const int32 Row = SlotToRow[PerfectHash.SlotOf(FTagPerfectHash::HashTag(Name))];
+				return reinterpret_cast<const void*>(static_cast<UPTRINT>(RowNames[Row] == Name ? Row + 1 : 0));
+			}, Sink);
+
+			UE_LOG(LogDataTableGameplayTag, Display, TEXT("  %6d %8.1f %8.1f %8.1f"), NumRows, ScanNs, MapNs, HashNs);
+			if (Crossover == INDEX_NONE && ScanNs > FMath::Min(MapNs, HashNs))
+			{
+				Crossover = NumRows;
+			}
+		}
+
+		if (Crossover == INDEX_NONE)
+		{
+			UE_LOG(LogDataTableGameplayTag, Display, TEXT("  Scan wins up to %d rows (sink %llx); current DataTableTag.ScanThreshold is %d"),
+				MaxRows, static_cast<uint64>(Sink), FDataTableTagIndex::GetScanThreshold());
+		}
+		else
+		{
+			UE_LOG(LogDataTableGameplayTag, Display, TEXT("  Scan loses from %d rows (sink %llx); current DataTableTag.ScanThreshold is %d"),
+				Crossover, static_cast<uint64>(Sink), FDataTableTagIndex::GetScanThreshold());
+		}
+	}
+
+	static FAutoConsoleCommand LookupCommand(
+		TEXT("DataTableTag.BenchmarkLookup"),
+		TEXT("Compares row lookups by name through FindRowUnchecked, a minimal perfect hash and the cached tag index. Usage: DataTableTag.BenchmarkLookup <TablePath> [Iterations=1000000]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunLookup));
+
+	static FAutoConsoleCommand StrategiesCommand(
+		TEXT("DataTableTag.BenchmarkStrategies"),
+		TEXT("Times SIMD scan, map and perfect hash lookups over synthetic tables of 4 to MaxRows rows to find the scan threshold. Usage: DataTableTag.BenchmarkStrategies [MaxRows=256]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunStrategies));
+}
+
+#endif
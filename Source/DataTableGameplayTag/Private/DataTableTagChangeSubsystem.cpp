@@ -0,0 +1,264 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "DataTableTagChangeSubsystem.h"
+#include "DataTableTagIndex.h"
+#include "DataTableTagInheritance.h"
+#include "Engine/DataTable.h"
+#include "Engine/Engine.h"
+#include "UObject/UObjectGlobals.h"
+
+const TCHAR* LexToString(EDataTableTagRowChange Change)
+{
+	switch (Change)
+	{
+	case EDataTableTagRowChange::Added:    return TEXT("Added");
+	case EDataTableTagRowChange::Modified: return TEXT("Modified");
+	default:                               return TEXT("Removed");
+	}
+}
+
+UDataTableTagChangeSubsystem* UDataTableTagChangeSubsystem::Get()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<UDataTableTagChangeSubsystem>() : nullptr;
+}
+
+void UDataTableTagChangeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UDataTableTagChangeSubsystem::OnPostGarbageCollect);
+}
+
+void UDataTableTagChangeSubsystem::Deinitialize()
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+
+	for (const TPair<TObjectKey<UDataTable>, FTableState>& Pair : Tables)
+	{
+		Unbind(Pair.Key, Pair.Value);
+	}
+	Tables.Reset();
+
+	Super::Deinitialize();
+}
+
+FDelegateHandle UDataTableTagChangeSubsystem::Subscribe(const UDataTable& Table, FGameplayTag Tag, FOnDataTableTagRowChanged Callback)
+{
+	return Tag.IsValid() ? AddSubscription(Table, Tag.GetTagName(), /*bSubtree*/false, MoveTemp(Callback)) : FDelegateHandle();
+}
+
+FDelegateHandle UDataTableTagChangeSubsystem::SubscribeSubtree(const UDataTable& Table, FGameplayTag Tag, FOnDataTableTagRowChanged Callback)
+{
+	return Tag.IsValid() ? AddSubscription(Table, Tag.GetTagName(), /*bSubtree*/true, MoveTemp(Callback)) : FDelegateHandle();
+}
+
+FDelegateHandle UDataTableTagChangeSubsystem::SubscribeAll(const UDataTable& Table, FOnDataTableTagRowChanged Callback)
+{
+	return AddSubscription(Table, NAME_None, /*bSubtree*/true, MoveTemp(Callback));
+}
+
+FDelegateHandle UDataTableTagChangeSubsystem::AddSubscription(const UDataTable& Table, FName TagName, bool bSubtree, FOnDataTableTagRowChanged Callback)
+{
+	check(IsInGameThread());
+
+	const TObjectKey<UDataTable> Key(&Table);
+	FTableState& State = Tables.FindOrAdd(Key);
+	if (!State.ChangedHandle.IsValid())
+	{
+		// Baseline the diff of the first change is taken against
+		TakeSnapshot(Table, State.RowHashes);
+		State.ChangedHandle = const_cast<UDataTable&>(Table).OnDataTableChanged().AddUObject(this, &UDataTableTagChangeSubsystem::OnTableChanged, Key);
+	}
+
+	FSubscription& Subscription = State.Subscriptions.AddDefaulted_GetRef();
+	Subscription.Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+	Subscription.TagName = TagName;
+	Subscription.bSubtree = bSubtree;
+	Subscription.Callback = MoveTemp(Callback);
+	return Subscription.Handle;
+}
+
+void UDataTableTagChangeSubsystem::Unsubscribe(FDelegateHandle Handle)
+{
+	if (!Handle.IsValid())
+	{
+		return;
+	}
+	if (DispatchDepth > 0)
+	{
+		Unsubscribed.Add(Handle);
+	}
+
+	for (auto It = Tables.CreateIterator(); It; ++It)
+	{
+		FTableState& State = It.Value();
+		if (State.Subscriptions.RemoveAll([Handle](const FSubscription& Subscription) { return Subscription.Handle == Handle; }) == 0)
+		{
+			continue;
+		}
+		if (State.Subscriptions.IsEmpty())
+		{
+			Unbind(It.Key(), State);
+			It.RemoveCurrent();
+		}
+		return;
+	}
+}
+
+int32 UDataTableTagChangeSubsystem::NumSubscriptions() const
+{
+	int32 Num = 0;
+	for (const TPair<TObjectKey<UDataTable>, FTableState>& Pair : Tables)
+	{
+		Num += Pair.Value.Subscriptions.Num();
+	}
+	return Num;
+}
+
+void UDataTableTagChangeSubsystem::GetTables(TArray<const UDataTable*>& OutTables) const
+{
+	for (const TPair<TObjectKey<UDataTable>, FTableState>& Pair : Tables)
+	{
+		if (const UDataTable* Table = Pair.Key.ResolveObjectPtr())
+		{
+			OutTables.AddUnique(Table);
+		}
+	}
+}
+
+SIZE_T UDataTableTagChangeSubsystem::GetAllocatedSize(const UDataTable& Table) const
+{
+	const FTableState* State = Tables.Find(TObjectKey<UDataTable>(&Table));
+	return State ? State->RowHashes.GetAllocatedSize() + State->Subscriptions.GetAllocatedSize() : 0;
+}
+
+uint32 UDataTableTagChangeSubsystem::HashRow(const UScriptStruct& RowStruct, const uint8* Row)
+{
+	FString Text;
+	RowStruct.ExportText(Text, Row, nullptr, nullptr, PPF_None, nullptr);
+	return FCrc::StrCrc32(*Text);
+}
+
+bool UDataTableTagChangeSubsystem::FSubscription::Matches(FName RowName) const
+{
+	if (TagName.IsNone() || RowName == TagName)
+	{
+		return true;
+	}
+	if (!bSubtree)
+	{
+		return false;
+	}
+
+	// Compared as strings, so rows whose tags were unregistered meanwhile still match
+	const FNameBuilder Row(RowName);
+	const FNameBuilder Tag(TagName);
+	return Row.Len() > Tag.Len() && Row.ToView()[Tag.Len()] == TEXT('.') && Row.ToView().StartsWith(Tag.ToView(), ESearchCase::IgnoreCase);
+}
+
+void UDataTableTagChangeSubsystem::TakeSnapshot(const UDataTable& Table, TMap<FName, uint32>& OutRowHashes)
+{
+	OutRowHashes.Reset();
+
+	const UScriptStruct* RowStruct = Table.GetRowStruct();
+	if (!RowStruct)
+	{
+		return;
+	}
+
+	if (FDataTableTagInheritance::IsInheriting(Table))
+	{
+		// A fresh index rather than the shared one, which may not have seen this change yet
+		const FDataTableTagIndex Index(Table);
+		OutRowHashes.Reserve(Index.Num());
+		for (int32 Row = 0; Row < Index.Num(); ++Row)
+		{
+			OutRowHashes.Add(Index.GetRowName(Row), HashRow(*RowStruct, Index.GetRow(Row)));
+		}
+		return;
+	}
+
+	OutRowHashes.Reserve(Table.GetRowMap().Num());
+	for (const TPair<FName, uint8*>& Pair : Table.GetRowMap())
+	{
+		OutRowHashes.Add(Pair.Key, HashRow(*RowStruct, Pair.Value));
+	}
+}
+
+void UDataTableTagChangeSubsystem::OnTableChanged(TObjectKey<UDataTable> Key)
+{
+	FTableState* State = Tables.Find(Key);
+	const UDataTable* Table = Key.ResolveObjectPtr();
+	if (!State || !Table)
+	{
+		return;
+	}
+
+	TMap<FName, uint32> RowHashes;
+	TakeSnapshot(*Table, RowHashes);
+
+	TArray<TPair<FName, EDataTableTagRowChange>> Changes;
+	for (const TPair<FName, uint32>& Pair : RowHashes)
+	{
+		const uint32* Previous = State->RowHashes.Find(Pair.Key);
+		if (!Previous)
+		{
+			Changes.Emplace(Pair.Key, EDataTableTagRowChange::Added);
+		}
+		else if (*Previous != Pair.Value)
+		{
+			Changes.Emplace(Pair.Key, EDataTableTagRowChange::Modified);
+		}
+	}
+	for (const TPair<FName, uint32>& Pair : State->RowHashes)
+	{
+		if (!RowHashes.Contains(Pair.Key))
+		{
+			Changes.Emplace(Pair.Key, EDataTableTagRowChange::Removed);
+		}
+	}
+	State->RowHashes = MoveTemp(RowHashes);
+
+	if (Changes.IsEmpty())
+	{
+		return;
+	}
+
+	// Callbacks may subscribe or unsubscribe, which can move or free the state; those unsubscribed meanwhile
+	// are skipped
+	const TArray<FSubscription> Subscriptions = State->Subscriptions;
+	++DispatchDepth;
+	for (const TPair<FName, EDataTableTagRowChange>& Change : Changes)
+	{
+		for (const FSubscription& Subscription : Subscriptions)
+		{
+			if (Subscription.Matches(Change.Key) && !Unsubscribed.Contains(Subscription.Handle))
+			{
+				Subscription.Callback.ExecuteIfBound(*Table, Change.Key, Change.Value);
+			}
+		}
+	}
+	if (--DispatchDepth == 0)
+	{
+		Unsubscribed.Reset();
+	}
+}
+
+void UDataTableTagChangeSubsystem::Unbind(TObjectKey<UDataTable> Key, const FTableState& State)
+{
+	if (UDataTable* Table = Key.ResolveObjectPtr())
+	{
+		Table->OnDataTableChanged().Remove(State.ChangedHandle);
+	}
+}
+
+void UDataTableTagChangeSubsystem::OnPostGarbageCollect()
+{
+	for (auto It = Tables.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,71 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "DataTableTagHash.h"
+#include "DataTableGameplayTag.h"
+#include "DataTableTagIndex.h"
+#include "Engine/DataTable.h"
+
+namespace DataTableTagHash
+{
+	/** Bumped whenever the serialized layout or the hash functions change. */
+	constexpr int32 Version = 1;
+}
+
+const FName UDataTableTagHash::SubobjectName(TEXT("DataTableTagHash"));
+
+const UDataTableTagHash* UDataTableTagHash::Find(const UDataTable& Table)
+{
+	return FindObjectFast<UDataTableTagHash>(const_cast<UDataTable*>(&Table), SubobjectName);
+}
+
+#if WITH_EDITOR
+UDataTableTagHash* UDataTableTagHash::Build(UDataTable& Table)
+{
+	TArray<FName> RowNames;
+	Table.GetRowMap().GenerateKeyArray(RowNames);
+
+	TArray<uint64> Hashes;
+	Hashes.Reserve(RowNames.Num());
+	for (const FName RowName : RowNames)
+	{
+		Hashes.Add(FTagPerfectHash::HashTag(RowName));
+	}
+
+	FTagPerfectHash PerfectHash;
+	if (!PerfectHash.Build(Hashes))
+	{
+		return nullptr;
+	}
+
+	UDataTableTagHash* TagHash = FindObjectFast<UDataTableTagHash>(&Table, SubobjectName);
+	if (!TagHash)
+	{
+		TagHash = NewObject<UDataTableTagHash>(&Table, SubobjectName);
+	}
+
+	TagHash->Hash = MoveTemp(PerfectHash);
+	TagHash->SlotToRow.SetNumUninitialized(RowNames.Num());
+	for (int32 Row = 0; Row < RowNames.Num(); ++Row)
+	{
+		TagHash->SlotToRow[TagHash->Hash.SlotOf(Hashes[Row])] = Row;
+	}
+	TagHash->Checksum = FDataTableTagIndex::ComputeChecksum(RowNames);
+	return TagHash;
+}
+#endif
+
+void UDataTableTagHash::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	int32 Version = DataTableTagHash::Version;
+	Ar << Version << Hash << SlotToRow << Checksum;
+
+	if (Ar.IsLoading() && Version != DataTableTagHash::Version)
+	{
+		// Cooked by another version of the hash functions: drop it so lookups fall back to the map
+		UE_LOG(LogDataTableGameplayTag, Warning, TEXT("%s was cooked with tag hash version %d, expected %d; ignoring it"), *GetPathName(), Version, DataTableTagHash::Version);
+		Hash = FTagPerfectHash();
+		SlotToRow.Reset();
+	}
+}
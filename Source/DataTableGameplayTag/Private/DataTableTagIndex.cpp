@@ -0,0 +1,579 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "DataTableTagIndex.h"
+#include "Async/ParallelFor.h"
+#include "DataTableGameplayTag.h"
+#include "DataTableTagHash.h"
+#include "DataTableTagIndexSubsystem.h"
+#include "DataTableTagInheritance.h"
+#include "DataTableTagScan.h"
+#include "DataTableTagStats.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagsSettings.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_STAT(STAT_DataTableTag_ScanLookups);
+DEFINE_STAT(STAT_DataTableTag_HashLookups);
+DEFINE_STAT(STAT_DataTableTag_MapLookups);
+DEFINE_STAT(STAT_DataTableTag_RedirectedLookups);
+DEFINE_STAT(STAT_DataTableTag_StringLookups);
+DEFINE_STAT(STAT_DataTableTag_ScanTables);
+DEFINE_STAT(STAT_DataTableTag_HashTables);
+DEFINE_STAT(STAT_DataTableTag_MapTables);
+DEFINE_STAT(STAT_DataTableTag_IndexMemory);
+
+namespace DataTableTagIndex
+{
+	/** Measured with DataTableTag.BenchmarkStrategies. */
+	int32 ScanThreshold = 64;
+	FAutoConsoleVariableRef CVarScanThreshold(
+		TEXT("DataTableTag.ScanThreshold"),
+		ScanThreshold,
+		TEXT("Tag-keyed tables with at most this many rows are looked up with a SIMD scan instead of a hash. Applies to indices built afterwards."));
+
+	/** Bindings of every loaded generated header; filled during static initialization. */
+	TArray<const FDataTableTagIndexBinding*>& Bindings()
+	{
+		static TArray<const FDataTableTagIndexBinding*> Registered;
+		return Registered;
+	}
+
+	/** FNV-1a over the lowercased characters, so it agrees with FName's case-insensitive equality. */
+	uint32 HashString(FStringView String)
+	{
+		uint32 Hash = 2166136261u;
+		for (const TCHAR Char : String)
+		{
+			Hash = (Hash ^ uint32(FChar::ToLower(Char))) * 16777619u;
+		}
+		return Hash;
+	}
+
+	uint32 HashName(FName Name)
+	{
+		const FNameBuilder Builder(Name);
+		return HashString(Builder.ToView());
+	}
+
+	/** Compares through a stack buffer, so neither side allocates. */
+	bool NameEquals(FName Name, FStringView String)
+	{
+		const FNameBuilder Builder(Name);
+		return Builder.ToView().Equals(String, ESearchCase::IgnoreCase);
+	}
+
+	/**
+	 * Old and final new name of every tag redirect of the project, with chains followed to their end. Reads
+	 * the settings CDO only, so indices built on worker threads can call it.
+	 */
+	void GatherRedirects(TArray<TPair<FName, FName>>& OutRedirects)
+	{
+		const TArray<FGameplayTagRedirect>& Redirects = GetDefault<UGameplayTagsSettings>()->GameplayTagRedirects;
+		if (Redirects.IsEmpty())
+		{
+			return;
+		}
+
+		TMap<FName, FName> NewNames;
+		NewNames.Reserve(Redirects.Num());
+		for (const FGameplayTagRedirect& Redirect : Redirects)
+		{
+			NewNames.Add(Redirect.OldTagName, Redirect.NewTagName);
+		}
+
+		OutRedirects.Reserve(NewNames.Num());
+		for (const TPair<FName, FName>& Pair : NewNames)
+		{
+			FName NewName = Pair.Value;
+			int32 Hops = 0;
+			while (const FName* Next = NewNames.Find(NewName))
+			{
+				// A cycle never resolves
+				if (++Hops > NewNames.Num())
+				{
+					NewName = NAME_None;
+					break;
+				}
+				NewName = *Next;
+			}
+			if (!NewName.IsNone())
+			{
+				OutRedirects.Emplace(Pair.Key, NewName);
+			}
+		}
+	}
+}
+
+const TCHAR* LexToString(EDataTableTagLookup Lookup)
+{
+	switch (Lookup)
+	{
+	case EDataTableTagLookup::Scan:        return TEXT("scan");
+	case EDataTableTagLookup::PerfectHash: return TEXT("perfect hash");
+	default:                               return TEXT("map");
+	}
+}
+
+FDataTableTagIndex::FDataTableTagIndex(const UDataTable& Table)
+	: FDataTableTagIndex(Table, UDataTableTagHash::Find(Table))
+{
+}
+
+FDataTableTagIndex::FDataTableTagIndex(const UDataTable& Table, const UDataTableTagHash* CookedHash)
+	: RowStruct(Table.GetRowStruct())
+{
+	const TMap<FName, uint8*>& RowMap = Table.GetRowMap();
+	RowNames.Reserve(RowMap.Num());
+	Rows.Reserve(RowMap.Num());
+	for (const TPair<FName, uint8*>& Pair : RowMap)
+	{
+		RowNames.Add(Pair.Key);
+		Rows.Add(Pair.Value);
+	}
+	Checksum = ComputeChecksum(RowNames);
+
+	// Cooked rows were flattened by the cooker already
+	if (RowStruct.IsValid() && RowNames.Num() > 0 && !FPlatformProperties::RequiresCookedData() && FDataTableTagInheritance::IsInheriting(Table))
+	{
+		FlattenedStruct.Reset(const_cast<UScriptStruct*>(RowStruct.Get()));
+		FlattenRows(*FlattenedStruct);
+	}
+
+	// Redirects are resolved here once, so lookups by old names never go through the tags manager
+	TArray<TPair<FName, FName>> Redirects;
+	DataTableTagIndex::GatherRedirects(Redirects);
+
+	if (RowNames.Num() <= GetScanThreshold())
+	{
+		Lookup = EDataTableTagLookup::Scan;
+		for (const TPair<FName, FName>& Redirect : Redirects)
+		{
+			const int32 Index = RowNames.IndexOfByKey(Redirect.Value);
+			if (Index != INDEX_NONE && !RowNames.Contains(Redirect.Key))
+			{
+				RedirectNames.Add(Redirect.Key);
+				RedirectRows.Add(Index);
+			}
+		}
+
+		// Redirect keys follow the row keys, so both are found by the same scan
+		ScanKeys.Reserve(Align(RowNames.Num() + RedirectNames.Num(), DataTableTagScan::BlockSize));
+		for (const FName RowName : RowNames)
+		{
+			ScanKeys.Add(DataTableTagScan::MakeKey(RowName));
+		}
+		for (const FName RedirectName : RedirectNames)
+		{
+			ScanKeys.Add(DataTableTagScan::MakeKey(RedirectName));
+		}
+		DataTableTagScan::Pad(ScanKeys);
+		INC_DWORD_STAT(STAT_DataTableTag_ScanTables);
+		return;
+	}
+
+	// A hash cooked for these exact rows replaces the map, unless redirects lead into the table: the hash only
+	// has slots for the row names, so old names would need a second lookup
+	if (CookedHash && CookedHash->Matches(Checksum, Rows.Num()))
+	{
+		const auto FindHashed = [CookedHash, this](FName Name)
+		{
+			const int32 Index = CookedHash->SlotToRow[CookedHash->Hash.SlotOf(FTagPerfectHash::HashTag(Name))];
+			return RowNames[Index] == Name ? Index : INDEX_NONE;
+		};
+		const bool bRedirected = Redirects.ContainsByPredicate([&FindHashed](const TPair<FName, FName>& Redirect)
+		{
+			return FindHashed(Redirect.Value) != INDEX_NONE && FindHashed(Redirect.Key) == INDEX_NONE;
+		});
+		if (!bRedirected)
+		{
+			Lookup = EDataTableTagLookup::PerfectHash;
+			PerfectHash = CookedHash->Hash;
+			SlotToRow = CookedHash->SlotToRow;
+			INC_DWORD_STAT(STAT_DataTableTag_HashTables);
+			return;
+		}
+		UE_LOG(LogDataTableGameplayTag, Verbose, TEXT("%s: tag redirects lead into the table, using a map instead of its cooked hash."), *Table.GetPathName());
+	}
+
+	Lookup = EDataTableTagLookup::Map;
+	NameToIndex.Reserve(RowNames.Num());
+	if (RowNames.Num() >= ParallelBuildThreshold)
+	{
+		// Only the inserts are serial
+		TArray<uint32> Hashes;
+		Hashes.SetNumUninitialized(RowNames.Num());
+		ParallelFor(RowNames.Num(), [this, &Hashes](int32 Index) { Hashes[Index] = GetTypeHash(RowNames[Index]); });
+		for (int32 Index = 0; Index < RowNames.Num(); ++Index)
+		{
+			NameToIndex.AddByHash(Hashes[Index], RowNames[Index], Index);
+		}
+	}
+	else
+	{
+		for (int32 Index = 0; Index < RowNames.Num(); ++Index)
+		{
+			NameToIndex.Add(RowNames[Index], Index);
+		}
+	}
+
+	for (const TPair<FName, FName>& Redirect : Redirects)
+	{
+		const int32* Index = NameToIndex.Find(Redirect.Value);
+		if (Index && !NameToIndex.Contains(Redirect.Key))
+		{
+			RedirectNames.Add(Redirect.Key);
+			RedirectRows.Add(*Index);
+		}
+	}
+	for (int32 Redirect = 0; Redirect < RedirectNames.Num(); ++Redirect)
+	{
+		NameToIndex.Add(RedirectNames[Redirect], RedirectRows[Redirect]);
+	}
+	INC_DWORD_STAT(STAT_DataTableTag_MapTables);
+}
+
+FDataTableTagIndex::~FDataTableTagIndex()
+{
+	if (FlattenedRows)
+	{
+		for (int32 Row = 0; Row < Rows.Num(); ++Row)
+		{
+			FlattenedStruct->DestroyStruct(FlattenedRows + Row * FlattenedStride);
+		}
+		FMemory::Free(FlattenedRows);
+	}
+
+	switch (Lookup)
+	{
+	case EDataTableTagLookup::Scan:        DEC_DWORD_STAT(STAT_DataTableTag_ScanTables); break;
+	case EDataTableTagLookup::PerfectHash: DEC_DWORD_STAT(STAT_DataTableTag_HashTables); break;
+	default:                               DEC_DWORD_STAT(STAT_DataTableTag_MapTables); break;
+	}
+}
+
+void FDataTableTagIndex::FlattenRows(const UScriptStruct& Struct)
+{
+	TArray<int32> Parents;
+	FDataTableTagInheritance::FindParentRows(RowNames, Parents);
+
+	FlattenedStride = Align(Struct.GetStructureSize(), Struct.GetMinAlignment());
+	FlattenedRows = static_cast<uint8*>(FMemory::Malloc(Rows.Num() * FlattenedStride, Struct.GetMinAlignment()));
+	for (int32 Row = 0; Row < Rows.Num(); ++Row)
+	{
+		uint8* Flattened = FlattenedRows + Row * FlattenedStride;
+		Struct.InitializeStruct(Flattened);
+		Struct.CopyScriptStruct(Flattened, Rows[Row]);
+	}
+
+	const FStructProperty* MaskProperty = FDataTableTagInheritance::FindMaskProperty(Struct);
+	uint8* Defaults = nullptr;
+	if (!MaskProperty)
+	{
+		Defaults = static_cast<uint8*>(FMemory::Malloc(Struct.GetStructureSize(), Struct.GetMinAlignment()));
+		Struct.InitializeStruct(Defaults);
+	}
+
+	// Each row is resolved after its ancestors, walking up the chain of those still pending
+	TBitArray<> Resolved(false, Rows.Num());
+	TArray<int32, TInlineAllocator<8>> Chain;
+	for (int32 Row = 0; Row < Rows.Num(); ++Row)
+	{
+		for (int32 Pending = Row; Pending != INDEX_NONE && !Resolved[Pending]; Pending = Parents[Pending])
+		{
+			Chain.Add(Pending);
+		}
+		while (Chain.Num() > 0)
+		{
+			const int32 Child = Chain.Pop(/*bAllowShrinking*/false);
+			if (Parents[Child] != INDEX_NONE)
+			{
+				FDataTableTagInheritance::InheritFields(Struct, MaskProperty, Defaults, FlattenedRows + Parents[Child] * FlattenedStride, FlattenedRows + Child * FlattenedStride);
+			}
+			Resolved[Child] = true;
+		}
+	}
+
+	if (Defaults)
+	{
+		Struct.DestroyStruct(Defaults);
+		FMemory::Free(Defaults);
+	}
+
+	for (int32 Row = 0; Row < Rows.Num(); ++Row)
+	{
+		Rows[Row] = FlattenedRows + Row * FlattenedStride;
+	}
+}
+
+SIZE_T FDataTableTagIndex::GetAllocatedSize() const
+{
+	return sizeof(*this) + RowNames.GetAllocatedSize() + Rows.GetAllocatedSize() + ScanKeys.GetAllocatedSize()
+		+ PerfectHash.Seeds.GetAllocatedSize() + SlotToRow.GetAllocatedSize() + NameToIndex.GetAllocatedSize()
+		+ Rows.Num() * FlattenedStride + RedirectNames.GetAllocatedSize() + RedirectRows.GetAllocatedSize() + StringHashes.GetAllocatedSize() + StringSlots.GetAllocatedSize();
+}
+
+int32 FDataTableTagIndex::GetScanThreshold()
+{
+	return DataTableTagIndex::ScanThreshold;
+}
+
+int32 FDataTableTagIndex::IndexOf(FName RowName) const
+{
+	switch (Lookup)
+	{
+	case EDataTableTagLookup::Scan:
+	{
+		INC_DWORD_STAT(STAT_DataTableTag_ScanLookups);
+		const int32 NumRows = RowNames.Num();
+		const int32 NumKeys = NumRows + RedirectNames.Num();
+		const int32 Index = DataTableTagScan::Find(ScanKeys.GetData(), ScanKeys.Num(), DataTableTagScan::MakeKey(RowName),
+			[this, RowName, NumRows, NumKeys](int32 Key)
+			{
+				return Key < NumRows ? RowNames[Key] == RowName : Key < NumKeys && RedirectNames[Key - NumRows] == RowName;
+			});
+		// Includes misses
+		if (Index < NumRows)
+		{
+			return Index;
+		}
+		INC_DWORD_STAT(STAT_DataTableTag_RedirectedLookups);
+		return RedirectRows[Index - NumRows];
+	}
+	case EDataTableTagLookup::PerfectHash:
+	{
+		// Any name maps to some slot, so the one stored there is compared once
+		INC_DWORD_STAT(STAT_DataTableTag_HashLookups);
+		const int32 Index = SlotToRow[PerfectHash.SlotOf(FTagPerfectHash::HashTag(RowName))];
+		return RowNames[Index] == RowName ? Index : INDEX_NONE;
+	}
+	default:
+	{
+		INC_DWORD_STAT(STAT_DataTableTag_MapLookups);
+		const int32* Index = NameToIndex.Find(RowName);
+		if (!Index)
+		{
+			return INDEX_NONE;
+		}
+#if STATS
+		if (RedirectNames.Num() > 0 && RowNames[*Index] != RowName)
+		{
+			INC_DWORD_STAT(STAT_DataTableTag_RedirectedLookups);
+		}
+#endif
+		return *Index;
+	}
+	}
+}
+
+int32 FDataTableTagIndex::IndexOfString(FStringView RowName) const
+{
+	check(IsInGameThread());
+	INC_DWORD_STAT(STAT_DataTableTag_StringLookups);
+
+	if (StringSlots.IsEmpty())
+	{
+		BuildStringIndex();
+	}
+
+	const int32 NumRows = RowNames.Num();
+	const uint32 Hash = DataTableTagIndex::HashString(RowName);
+	const uint32 Mask = uint32(StringSlots.Num() - 1);
+	for (uint32 Slot = Hash & Mask; StringSlots[Slot] != INDEX_NONE; Slot = (Slot + 1) & Mask)
+	{
+		const int32 Key = StringSlots[Slot];
+		if (StringHashes[Key] != Hash)
+		{
+			continue;
+		}
+		if (Key < NumRows)
+		{
+			if (DataTableTagIndex::NameEquals(RowNames[Key], RowName))
+			{
+				return Key;
+			}
+		}
+		else if (DataTableTagIndex::NameEquals(RedirectNames[Key - NumRows], RowName))
+		{
+			INC_DWORD_STAT(STAT_DataTableTag_RedirectedLookups);
+			return RedirectRows[Key - NumRows];
+		}
+	}
+	return INDEX_NONE;
+}
+
+void FDataTableTagIndex::BuildStringIndex() const
+{
+	const int32 NumRows = RowNames.Num();
+	const int32 NumKeys = NumRows + RedirectNames.Num();
+	StringHashes.SetNumUninitialized(NumKeys);
+	ParallelFor(NumKeys, [this, NumRows](int32 Key)
+	{
+		StringHashes[Key] = DataTableTagIndex::HashName(Key < NumRows ? RowNames[Key] : RedirectNames[Key - NumRows]);
+	}, NumKeys < ParallelBuildThreshold ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// At most half full, and never empty so a lookup always reaches a free slot
+	StringSlots.Init(INDEX_NONE, FMath::RoundUpToPowerOfTwo(FMath::Max(NumKeys * 2, 2)));
+	const uint32 Mask = uint32(StringSlots.Num() - 1);
+	for (int32 Key = 0; Key < NumKeys; ++Key)
+	{
+		uint32 Slot = StringHashes[Key] & Mask;
+		while (StringSlots[Slot] != INDEX_NONE)
+		{
+			Slot = (Slot + 1) & Mask;
+		}
+		StringSlots[Slot] = Key;
+	}
+}
+
+uint32 FDataTableTagIndex::ComputeChecksum(TConstArrayView<FName> RowNames)
+{
+	// Row names compare case-insensitively, so the checksum does as well
+	if (RowNames.Num() >= ParallelBuildThreshold)
+	{
+		// Lowercased names and separators are laid out in one buffer in parallel; the CRC of the buffer is the
+		// CRC of the names one after the other
+		TArray<int32> Offsets;
+		Offsets.SetNumUninitialized(RowNames.Num() + 1);
+		Offsets[0] = 0;
+		ParallelFor(RowNames.Num(), [&RowNames, &Offsets](int32 Index) { Offsets[Index + 1] = RowNames[Index].GetStringLength() + 1; });
+		for (int32 Index = 0; Index < RowNames.Num(); ++Index)
+		{
+			Offsets[Index + 1] += Offsets[Index];
+		}
+
+		TArray<TCHAR> Buffer;
+		Buffer.SetNumUninitialized(Offsets.Last() + 1);
+		ParallelFor(RowNames.Num(), [&RowNames, &Offsets, &Buffer](int32 Index)
+		{
+			TCHAR* Out = Buffer.GetData() + Offsets[Index];
+			const uint32 Len = RowNames[Index].ToString(Out, Offsets[Index + 1] - Offsets[Index]);
+			for (uint32 Char = 0; Char < Len; ++Char)
+			{
+				Out[Char] = FChar::ToLower(Out[Char]);
+			}
+			Out[Len] = TEXT('\n');
+		});
+		Buffer.Last() = TEXT('\0');
+		return FCrc::StrCrc32(Buffer.GetData());
+	}
+
+	uint32 Crc = 0;
+	TCHAR Buffer[NAME_SIZE];
+	for (const FName RowName : RowNames)
+	{
+		const uint32 Len = RowName.ToString(Buffer);
+		for (uint32 Index = 0; Index < Len; ++Index)
+		{
+			Buffer[Index] = FChar::ToLower(Buffer[Index]);
+		}
+		Crc = FCrc::StrCrc32(Buffer, Crc);
+		Crc = FCrc::StrCrc32(TEXT("\n"), Crc);
+	}
+	return Crc;
+}
+
+TSharedRef<const FDataTableTagIndex> FDataTableTagIndex::Get(const UDataTable& Table)
+{
+	if (UDataTableTagIndexSubsystem* Subsystem = UDataTableTagIndexSubsystem::Get())
+	{
+		return Subsystem->FindOrBuild(Table).ToSharedRef();
+	}
+	return MakeShared<FDataTableTagIndex>(Table);
+}
+
+const uint8* FDataTableTagIndex::FindRow(const UDataTable& Table, FName RowName)
+{
+	UDataTableTagIndexSubsystem* Subsystem = UDataTableTagIndexSubsystem::Get();
+	if (!Subsystem)
+	{
+		return Table.FindRowUnchecked(RowName);
+	}
+
+	// No reference count traffic on the lookup path
+	const FDataTableTagIndex& Index = *Subsystem->FindOrBuild(Table);
+	return Index.GetRow(Index.IndexOf(RowName));
+}
+
+const uint8* FDataTableTagIndex::FindRowByString(const UDataTable& Table, FStringView RowName)
+{
+	UDataTableTagIndexSubsystem* Subsystem = UDataTableTagIndexSubsystem::Get();
+	if (!Subsystem)
+	{
+		// Finding never adds to the name table
+		const FName Name(RowName.Len(), RowName.GetData(), FNAME_Find);
+		return Name.IsNone() ? nullptr : Table.FindRowUnchecked(Name);
+	}
+
+	const FDataTableTagIndex& Index = *Subsystem->FindOrBuild(Table);
+	return Index.GetRow(Index.IndexOfString(RowName));
+}
+
+const uint8* FDataTableTagIndex::FindRowByIndex(const UDataTable& Table, int32 RowIndex, uint32 ExpectedChecksum, const UScriptStruct* ExpectedStruct)
+{
+	const TSharedRef<const FDataTableTagIndex> Index = Get(Table);
+	if (Index->Checksum != ExpectedChecksum)
+	{
+		return nullptr;
+	}
+	if (ExpectedStruct && !(Index->GetRowStruct() && Index->GetRowStruct()->IsChildOf(ExpectedStruct)))
+	{
+		return nullptr;
+	}
+	if (!UDataTableTagIndexSubsystem::Get())
+	{
+		// The throwaway index and any rows it flattened are gone once this returns
+		return Table.FindRowUnchecked(Index->GetRowName(RowIndex));
+	}
+	return Index->GetRow(RowIndex);
+}
+
+void FDataTableTagIndex::ResetCache()
+{
+	if (UDataTableTagIndexSubsystem* Subsystem = UDataTableTagIndexSubsystem::Get())
+	{
+		Subsystem->Reset();
+	}
+}
+
+FDataTableTagIndexBinding::FDataTableTagIndexBinding(const TCHAR* InTablePath, uint32 InChecksum, int32 InNumRows)
+	: TablePath(InTablePath)
+	, Checksum(InChecksum)
+	, NumRows(InNumRows)
+{
+	DataTableTagIndex::Bindings().Add(this);
+}
+
+FDataTableTagIndexBinding::~FDataTableTagIndexBinding()
+{
+	DataTableTagIndex::Bindings().RemoveSingleSwap(this);
+}
+
+bool FDataTableTagIndexBinding::Validate(const FDataTableTagIndex& Index) const
+{
+	if (Index.GetChecksum() == Checksum && Index.Num() == NumRows)
+	{
+		return true;
+	}
+
+	UE_LOG(LogDataTableGameplayTag, Error, TEXT("Generated row indices of %s are stale (%d rows, checksum %08x; table has %d rows, checksum %08x). Regenerate the row index header."),
+		TablePath, NumRows, Checksum, Index.Num(), Index.GetChecksum());
+	return false;
+}
+
+void FDataTableTagIndexBinding::ValidateTable(const UDataTable& Table, const FDataTableTagIndex& Index)
+{
+	const TArray<const FDataTableTagIndexBinding*>& Bindings = DataTableTagIndex::Bindings();
+	if (Bindings.Num() == 0)
+	{
+		return;
+	}
+
+	const FString PathName = Table.GetPathName();
+	for (const FDataTableTagIndexBinding* Binding : Bindings)
+	{
+		if (PathName.Equals(Binding->TablePath, ESearchCase::IgnoreCase))
+		{
+			Binding->Validate(Index);
+		}
+	}
+}
@@ -0,0 +1,340 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "DataTableTagIndexSubsystem.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "DataTableGameplayTag.h"
+#include "DataTableGameplayTagSettings.h"
+#include "DataTableTagHash.h"
+#include "DataTableTagIndex.h"
+#include "DataTableTagRowData.h"
+#include "DataTableTagStats.h"
+#include "Engine/AssetManager.h"
+#include "Engine/DataTable.h"
+#include "Engine/Engine.h"
+#include "GameplayTagsModule.h"
+#include "HAL/IConsoleManager.h"
+#include "Tasks/Task.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace DataTableTagIndexSubsystem
+{
+	/** Idle indices are looked for this often. */
+	constexpr float TickInterval = 5.f;
+
+	static FAutoConsoleCommandWithOutputDevice ListCommand(
+		TEXT("DataTableTag.ListIndices"),
+		TEXT("Lists the shared row index of every tag-keyed table with its memory and idle time."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+		{
+			if (const UDataTableTagIndexSubsystem* Subsystem = UDataTableTagIndexSubsystem::Get())
+			{
+				Subsystem->Dump(Ar);
+			}
+		}));
+}
+
+uint32 UDataTableTagIndexSubsystem::ChangeGeneration = 1;
+
+UDataTableTagIndexSubsystem* UDataTableTagIndexSubsystem::Get()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<UDataTableTagIndexSubsystem>() : nullptr;
+}
+
+void UDataTableTagIndexSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Now = FPlatformTime::Seconds();
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UDataTableTagIndexSubsystem::Tick), DataTableTagIndexSubsystem::TickInterval);
+	PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddUObject(this, &UDataTableTagIndexSubsystem::OnPreLoadMap);
+	TagSettingsChangedHandle = IGameplayTagsModule::OnTagSettingsChanged.AddUObject(this, &UDataTableTagIndexSubsystem::OnTagSettingsChanged);
+}
+
+void UDataTableTagIndexSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	FCoreUObjectDelegates::PreLoadMap.Remove(PreLoadMapHandle);
+	IGameplayTagsModule::OnTagSettingsChanged.Remove(TagSettingsChangedHandle);
+	PrewarmHandles.Reset();
+	Reset();
+
+	Super::Deinitialize();
+}
+
+UDataTableTagIndexSubsystem::FEntry& UDataTableTagIndexSubsystem::FindOrAddEntry(const UDataTable& Table)
+{
+	check(IsInGameThread());
+
+	const TObjectKey<UDataTable> Key(&Table);
+	FEntry& Entry = Entries.FindOrAdd(Key);
+	Entry.LastUsed = Now;
+	if (!Entry.ChangedHandle.IsValid())
+	{
+		// Imports and edits broadcast this after modifying the row map
+		Entry.ChangedHandle = const_cast<UDataTable&>(Table).OnDataTableChanged().AddUObject(this, &UDataTableTagIndexSubsystem::OnTableChanged, Key);
+	}
+	return Entry;
+}
+
+const TSharedPtr<const FDataTableTagIndex>& UDataTableTagIndexSubsystem::FindOrBuild(const UDataTable& Table)
+{
+	FEntry& Entry = FindOrAddEntry(Table);
+	if (!Entry.Index.IsValid())
+	{
+		const TSharedRef<const FDataTableTagIndex> Index = MakeShared<FDataTableTagIndex>(Table);
+		FDataTableTagIndexBinding::ValidateTable(Table, *Index);
+		FDataTableTagRowDataBinding::ValidateTable(Table, *Index);
+		Entry.Index = Index;
+	}
+	return Entry.Index;
+}
+
+void UDataTableTagIndexSubsystem::Prewarm(TArray<FSoftObjectPath> Tables, FSimpleDelegate OnComplete)
+{
+	check(IsInGameThread());
+
+	++NumPrewarming;
+	Tables.RemoveAll([](const FSoftObjectPath& Table) { return Table.IsNull(); });
+	TSharedPtr<FStreamableHandle> Handle;
+	if (Tables.Num() > 0)
+	{
+		Handle = StreamableManager.RequestAsyncLoad(Tables, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+	}
+	if (Handle.IsValid())
+	{
+		PrewarmHandles.Add(Handle);
+	}
+	if (Handle.IsValid() && Handle->IsLoadingInProgress())
+	{
+		Handle->BindCompleteDelegate(FStreamableDelegate::CreateUObject(this, &UDataTableTagIndexSubsystem::OnPrewarmLoaded, MoveTemp(Tables), TWeakPtr<FStreamableHandle>(Handle), MoveTemp(OnComplete)));
+	}
+	else
+	{
+		OnPrewarmLoaded(MoveTemp(Tables), Handle, MoveTemp(OnComplete));
+	}
+}
+
+void UDataTableTagIndexSubsystem::PrewarmFromSettings(FSimpleDelegate OnComplete)
+{
+	const UDataTableGameplayTagSettings* Settings = GetDefault<UDataTableGameplayTagSettings>();
+	TArray<FSoftObjectPath> Tables;
+	for (const TSoftObjectPtr<UDataTable>& Table : Settings->PrewarmTables)
+	{
+		Tables.Add(Table.ToSoftObjectPath());
+	}
+	if (UAssetManager::IsInitialized())
+	{
+		TArray<FSoftObjectPath> Paths;
+		for (const FPrimaryAssetType& Type : Settings->PrewarmPrimaryAssetTypes)
+		{
+			UAssetManager::Get().GetPrimaryAssetPathList(Type, Paths);
+		}
+		Tables.Append(Paths);
+	}
+
+	// The new request holds tables shared with the previous map before the old handles let go of them; builds
+	// still running keep their own reference
+	TArray<TSharedPtr<FStreamableHandle>> PreviousHandles = MoveTemp(PrewarmHandles);
+	Prewarm(MoveTemp(Tables), MoveTemp(OnComplete));
+}
+
+void UDataTableTagIndexSubsystem::OnPreLoadMap(const FString& MapName)
+{
+	if (GetDefault<UDataTableGameplayTagSettings>()->bPrewarmOnMapLoad)
+	{
+		PrewarmFromSettings();
+	}
+}
+
+void UDataTableTagIndexSubsystem::OnPrewarmLoaded(TArray<FSoftObjectPath> Tables, TWeakPtr<FStreamableHandle> WeakHandle, FSimpleDelegate OnComplete)
+{
+	TSharedPtr<FStreamableHandle> Handle = WeakHandle.Pin();
+
+	// Cooked hashes are found here, since finding objects is not safe on workers; entries are added now so
+	// changes made while building are noticed
+	TArray<TObjectKey<UDataTable>> Keys;
+	TArray<const UDataTable*> ToBuild;
+	TArray<const UDataTableTagHash*> CookedHashes;
+	for (const FSoftObjectPath& Path : Tables)
+	{
+		const UDataTable* Table = Cast<UDataTable>(Path.ResolveObject());
+		if (Table && !FindOrAddEntry(*Table).Index.IsValid())
+		{
+			Keys.Add(TObjectKey<UDataTable>(Table));
+			ToBuild.Add(Table);
+			CookedHashes.Add(UDataTableTagHash::Find(*Table));
+		}
+	}
+
+	// The handle keeps the tables loaded until the indices are installed
+	TWeakObjectPtr<UDataTableTagIndexSubsystem> WeakThis(this);
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Keys = MoveTemp(Keys), ToBuild = MoveTemp(ToBuild), CookedHashes = MoveTemp(CookedHashes), Handle = MoveTemp(Handle), TableChangesAtStart = NumTableChanges, OnComplete = MoveTemp(OnComplete)]() mutable
+	{
+		TArray<TSharedPtr<const FDataTableTagIndex>> Indices;
+		Indices.SetNum(ToBuild.Num());
+		ParallelFor(ToBuild.Num(), [&](int32 Index)
+		{
+			Indices[Index] = MakeShared<FDataTableTagIndex>(*ToBuild[Index], CookedHashes[Index]);
+		});
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Keys = MoveTemp(Keys), Indices = MoveTemp(Indices), Handle = MoveTemp(Handle), TableChangesAtStart, OnComplete = MoveTemp(OnComplete)]() mutable
+		{
+			if (UDataTableTagIndexSubsystem* This = WeakThis.Get())
+			{
+				This->FinishPrewarm(Keys, MoveTemp(Indices), TableChangesAtStart, MoveTemp(OnComplete));
+			}
+		});
+	});
+}
+
+void UDataTableTagIndexSubsystem::FinishPrewarm(TConstArrayView<TObjectKey<UDataTable>> Tables, TArray<TSharedPtr<const FDataTableTagIndex>> Indices, uint32 TableChangesAtStart, FSimpleDelegate OnComplete)
+{
+	int32 NumInstalled = 0;
+	if (NumTableChanges == TableChangesAtStart)
+	{
+		for (int32 Index = 0; Index < Tables.Num(); ++Index)
+		{
+			const UDataTable* Table = Tables[Index].ResolveObjectPtr();
+			if (!Table)
+			{
+				continue;
+			}
+			FEntry& Entry = FindOrAddEntry(*Table);
+			if (!Entry.Index.IsValid())
+			{
+				FDataTableTagIndexBinding::ValidateTable(*Table, *Indices[Index]);
+				FDataTableTagRowDataBinding::ValidateTable(*Table, *Indices[Index]);
+				Entry.Index = MoveTemp(Indices[Index]);
+				++NumInstalled;
+			}
+		}
+	}
+	else
+	{
+		UE_LOG(LogDataTableGameplayTag, Verbose, TEXT("Tables changed while prewarming; their indices are built on first use instead"));
+	}
+
+	--NumPrewarming;
+	OnComplete.ExecuteIfBound();
+	OnPrewarmed.Broadcast(NumInstalled);
+}
+
+int32 UDataTableTagIndexSubsystem::EvictUnused(double MaxIdleSeconds)
+{
+	int32 NumEvicted = 0;
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		const FEntry& Entry = It.Value();
+		const bool bTableGone = !It.Key().ResolveObjectPtr();
+		const bool bIdle = Now - Entry.LastUsed > MaxIdleSeconds && (!Entry.Index.IsValid() || Entry.Index.IsUnique());
+		if (bTableGone || bIdle)
+		{
+			Unbind(It.Key(), Entry);
+			It.RemoveCurrent();
+			++NumEvicted;
+		}
+	}
+	if (NumEvicted > 0)
+	{
+		++ChangeGeneration;
+	}
+	return NumEvicted;
+}
+
+void UDataTableTagIndexSubsystem::Reset()
+{
+	for (const TPair<TObjectKey<UDataTable>, FEntry>& Pair : Entries)
+	{
+		Unbind(Pair.Key, Pair.Value);
+	}
+	Entries.Reset();
+	++ChangeGeneration;
+	SET_MEMORY_STAT(STAT_DataTableTag_IndexMemory, 0);
+}
+
+SIZE_T UDataTableTagIndexSubsystem::GetAllocatedSize() const
+{
+	SIZE_T Size = Entries.GetAllocatedSize();
+	for (const TPair<TObjectKey<UDataTable>, FEntry>& Pair : Entries)
+	{
+		if (Pair.Value.Index.IsValid())
+		{
+			Size += Pair.Value.Index->GetAllocatedSize();
+		}
+	}
+	return Size;
+}
+
+const FDataTableTagIndex* UDataTableTagIndexSubsystem::FindExisting(const UDataTable& Table) const
+{
+	const FEntry* Entry = Entries.Find(TObjectKey<UDataTable>(&Table));
+	return Entry ? Entry->Index.Get() : nullptr;
+}
+
+void UDataTableTagIndexSubsystem::GetTables(TArray<const UDataTable*>& OutTables) const
+{
+	for (const TPair<TObjectKey<UDataTable>, FEntry>& Pair : Entries)
+	{
+		if (const UDataTable* Table = Pair.Key.ResolveObjectPtr())
+		{
+			OutTables.AddUnique(Table);
+		}
+	}
+}
+
+void UDataTableTagIndexSubsystem::Dump(FOutputDevice& Ar) const
+{
+	const double CurrentTime = FPlatformTime::Seconds();
+	for (const TPair<TObjectKey<UDataTable>, FEntry>& Pair : Entries)
+	{
+		const UDataTable* Table = Pair.Key.ResolveObjectPtr();
+		const FDataTableTagIndex* Index = Pair.Value.Index.Get();
+		Ar.Logf(TEXT("  %s: %s, idle %.0f s"),
+			Table ? *Table->GetPathName() : TEXT("<unloaded>"),
+			Index ? *FString::Printf(TEXT("%d rows, %s, %llu bytes, %d refs"), Index->Num(), LexToString(Index->GetLookup()),
+				static_cast<uint64>(Index->GetAllocatedSize()), Pair.Value.Index.GetSharedReferenceCount()) : TEXT("stale"),
+			CurrentTime - Pair.Value.LastUsed);
+	}
+	Ar.Logf(TEXT("%d tag-keyed table indices, %llu bytes"), Entries.Num(), static_cast<uint64>(GetAllocatedSize()));
+}
+
+bool UDataTableTagIndexSubsystem::Tick(float DeltaTime)
+{
+	Now = FPlatformTime::Seconds();
+
+	const float EvictionTime = GetDefault<UDataTableGameplayTagSettings>()->IndexEvictionTime;
+	const int32 NumEvicted = EvictUnused(EvictionTime > 0.f ? EvictionTime : TNumericLimits<double>::Max());
+	UE_CLOG(NumEvicted > 0, LogDataTableGameplayTag, Verbose, TEXT("Released %d idle tag-keyed table indices"), NumEvicted);
+
+	SET_MEMORY_STAT(STAT_DataTableTag_IndexMemory, GetAllocatedSize());
+	return true;
+}
+
+void UDataTableTagIndexSubsystem::OnTableChanged(TObjectKey<UDataTable> Key)
+{
+	if (FEntry* Entry = Entries.Find(Key))
+	{
+		Entry->Index.Reset();
+	}
+	++ChangeGeneration;
+	++NumTableChanges;
+}
+
+void UDataTableTagIndexSubsystem::OnTagSettingsChanged()
+{
+	for (TPair<TObjectKey<UDataTable>, FEntry>& Pair : Entries)
+	{
+		Pair.Value.Index.Reset();
+	}
+	++ChangeGeneration;
+	++NumTableChanges;
+}
+
+void UDataTableTagIndexSubsystem::Unbind(TObjectKey<UDataTable> Key, const FEntry& Entry)
+{
+	if (UDataTable* Table = Key.ResolveObjectPtr())
+	{
+		Table->OnDataTableChanged().Remove(Entry.ChangedHandle);
+	}
+}
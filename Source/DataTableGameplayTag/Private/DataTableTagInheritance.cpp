@@ -0,0 +1,75 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "DataTableTagInheritance.h"
+#include "DataTableGameplayTagSettings.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagContainer.h"
+
+bool FDataTableTagInheritance::IsInheriting(const UDataTable& Table)
+{
+	const TArray<TSoftObjectPtr<UDataTable>>& Tables = GetDefault<UDataTableGameplayTagSettings>()->InheritingTables;
+	if (Tables.IsEmpty())
+	{
+		return false;
+	}
+
+	const FSoftObjectPath TablePath(&Table);
+	return Tables.ContainsByPredicate([&TablePath](const TSoftObjectPtr<UDataTable>& Inheriting) { return Inheriting.ToSoftObjectPath() == TablePath; });
+}
+
+const FStructProperty* FDataTableTagInheritance::FindMaskProperty(const UScriptStruct& RowStruct)
+{
+	for (TFieldIterator<FStructProperty> It(&RowStruct); It; ++It)
+	{
+		if (It->Struct == FDataTableTagOverrideMask::StaticStruct())
+		{
+			return *It;
+		}
+	}
+	return nullptr;
+}
+
+void FDataTableTagInheritance::FindParentRows(TConstArrayView<FName> RowNames, TArray<int32>& OutParents)
+{
+	TMap<FName, int32> NameToRow;
+	NameToRow.Reserve(RowNames.Num());
+	for (int32 Row = 0; Row < RowNames.Num(); ++Row)
+	{
+		NameToRow.Add(RowNames[Row], Row);
+	}
+
+	OutParents.Init(INDEX_NONE, RowNames.Num());
+	for (int32 Row = 0; Row < RowNames.Num(); ++Row)
+	{
+		// Parents without a row are skipped, so Weapon.Rifle.Assault inherits from Weapon if Weapon.Rifle has none
+		FGameplayTag Parent = FGameplayTag::RequestGameplayTag(RowNames[Row], /*ErrorIfNotFound*/false).RequestDirectParent();
+		while (Parent.IsValid())
+		{
+			if (const int32* ParentRow = NameToRow.Find(Parent.GetTagName()))
+			{
+				OutParents[Row] = *ParentRow;
+				break;
+			}
+			Parent = Parent.RequestDirectParent();
+		}
+	}
+}
+
+void FDataTableTagInheritance::InheritFields(const UScriptStruct& RowStruct, const FStructProperty* MaskProperty, const uint8* Defaults, const uint8* Parent, uint8* Row)
+{
+	const FDataTableTagOverrideMask* Mask = MaskProperty ? MaskProperty->ContainerPtrToValuePtr<FDataTableTagOverrideMask>(Row) : nullptr;
+	for (TFieldIterator<FProperty> It(&RowStruct); It; ++It)
+	{
+		const FProperty* Property = *It;
+		if (Property == MaskProperty)
+		{
+			continue;
+		}
+
+		const bool bOverridden = Mask ? Mask->Fields.Contains(Property->GetFName()) : !Property->Identical_InContainer(Row, Defaults);
+		if (!bOverridden)
+		{
+			Property->CopyCompleteValue_InContainer(Row, Parent);
+		}
+	}
+}
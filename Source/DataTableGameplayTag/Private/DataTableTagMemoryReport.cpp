@@ -0,0 +1,301 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "DataTableTagMemoryReport.h"
+#include "DataTableTagChangeSubsystem.h"
+#include "DataTableTagIndex.h"
+#include "DataTableTagIndexSubsystem.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagContainer.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "UObject/UObjectIterator.h"
+
+namespace DataTableTagMemoryReport
+{
+	SIZE_T GetHeapSize(const FProperty* Property, const void* Value);
+
+	SIZE_T GetStructHeapSize(const UStruct* Struct, const void* Container)
+	{
+		SIZE_T Size = 0;
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			for (int32 Element = 0; Element < It->ArrayDim; ++Element)
+			{
+				Size += GetHeapSize(*It, It->ContainerPtrToValuePtr<void>(Container, Element));
+			}
+		}
+		return Size;
+	}
+
+	/** Heap owned by a value; container hash buckets are not counted. */
+	SIZE_T GetHeapSize(const FProperty* Property, const void* Value)
+	{
+		if (Property->IsA<FStrProperty>())
+		{
+			return static_cast<const FString*>(Value)->GetAllocatedSize();
+		}
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			return GetStructHeapSize(StructProperty->Struct, Value);
+		}
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			FScriptArrayHelper Helper(ArrayProperty, Value);
+			SIZE_T Size = SIZE_T(static_cast<const FScriptArray*>(Value)->Max()) * ArrayProperty->Inner->ElementSize;
+			for (int32 Index = 0; Index < Helper.Num(); ++Index)
+			{
+				Size += GetHeapSize(ArrayProperty->Inner, Helper.GetRawPtr(Index));
+			}
+			return Size;
+		}
+		if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			FScriptSetHelper Helper(SetProperty, Value);
+			SIZE_T Size = SIZE_T(Helper.GetMaxIndex()) * Helper.SetLayout.Size;
+			for (int32 Index = 0; Index < Helper.GetMaxIndex(); ++Index)
+			{
+				if (Helper.IsValidIndex(Index))
+				{
+					Size += GetHeapSize(SetProperty->ElementProp, Helper.GetElementPtr(Index));
+				}
+			}
+			return Size;
+		}
+		if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			FScriptMapHelper Helper(MapProperty, Value);
+			SIZE_T Size = SIZE_T(Helper.GetMaxIndex()) * Helper.MapLayout.SetLayout.Size;
+			for (int32 Index = 0; Index < Helper.GetMaxIndex(); ++Index)
+			{
+				if (Helper.IsValidIndex(Index))
+				{
+					Size += GetHeapSize(MapProperty->KeyProp, Helper.GetKeyPtr(Index)) + GetHeapSize(MapProperty->ValueProp, Helper.GetValuePtr(Index));
+				}
+			}
+			return Size;
+		}
+		return 0;
+	}
+
+	/** Rows are grouped by value hash, then compared within each group. */
+	int32 CountDuplicateRows(const UScriptStruct& RowStruct, const TMap<FName, uint8*>& RowMap)
+	{
+		TMap<uint32, TArray<const uint8*, TInlineAllocator<1>>> RowsByHash;
+		RowsByHash.Reserve(RowMap.Num());
+		int32 NumDuplicates = 0;
+		for (const TPair<FName, uint8*>& Pair : RowMap)
+		{
+			TArray<const uint8*, TInlineAllocator<1>>& Rows = RowsByHash.FindOrAdd(UDataTableTagChangeSubsystem::HashRow(RowStruct, Pair.Value));
+			if (Rows.ContainsByPredicate([&RowStruct, &Pair](const uint8* Row) { return RowStruct.CompareScriptStruct(Row, Pair.Value, PPF_None); }))
+			{
+				++NumDuplicates;
+			}
+			else
+			{
+				Rows.Add(Pair.Value);
+			}
+		}
+		return NumDuplicates;
+	}
+
+	bool IsTagKeyed(const UDataTable& Table)
+	{
+		const TMap<FName, uint8*>& RowMap = Table.GetRowMap();
+		if (RowMap.Num() == 0)
+		{
+			return false;
+		}
+		for (const TPair<FName, uint8*>& Pair : RowMap)
+		{
+			if (!FGameplayTag::RequestGameplayTag(Pair.Key, /*ErrorIfNotFound*/false).IsValid())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	double KiB(SIZE_T Bytes)
+	{
+		return double(Bytes) / 1024.0;
+	}
+
+	static FAutoConsoleCommandWithArgsAndOutputDevice MemReportCommand(
+		TEXT("DataTableTag.MemReport"),
+		TEXT("Reports the memory of tag-keyed tables and their indices and caches. Usage: DataTableTag.MemReport [-All] [-Sort=Total|Rows|Heap|Index|Duplicates|Name] [-CSV=<File>]"),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, FOutputDevice& Ar)
+		{
+			// Leading space so FParse::Param finds the first switch
+			FDataTableTagMemoryReport::Run(*(TEXT(" ") + FString::Join(Args, TEXT(" "))), Ar);
+		}));
+}
+
+void FDataTableTagMemoryReport::Gather(bool bAllTables, TArray<FDataTableTagMemoryStats>& OutStats)
+{
+	check(IsInGameThread());
+
+	TArray<const UDataTable*> Tables;
+	if (const UDataTableTagIndexSubsystem* IndexSubsystem = UDataTableTagIndexSubsystem::Get())
+	{
+		IndexSubsystem->GetTables(Tables);
+	}
+	if (const UDataTableTagChangeSubsystem* ChangeSubsystem = UDataTableTagChangeSubsystem::Get())
+	{
+		ChangeSubsystem->GetTables(Tables);
+	}
+	if (bAllTables)
+	{
+		for (TObjectIterator<UDataTable> It; It; ++It)
+		{
+			if (!It->HasAnyFlags(RF_ClassDefaultObject) && DataTableTagMemoryReport::IsTagKeyed(**It))
+			{
+				Tables.AddUnique(*It);
+			}
+		}
+	}
+
+	OutStats.Reset(Tables.Num());
+	for (const UDataTable* Table : Tables)
+	{
+		OutStats.Add(Measure(*Table));
+	}
+}
+
+FDataTableTagMemoryStats FDataTableTagMemoryReport::Measure(const UDataTable& Table)
+{
+	FDataTableTagMemoryStats Stats;
+	Stats.TablePath = Table.GetPathName();
+
+	const TMap<FName, uint8*>& RowMap = Table.GetRowMap();
+	Stats.NumRows = RowMap.Num();
+	Stats.RowMapBytes = RowMap.GetAllocatedSize();
+
+	if (const UScriptStruct* RowStruct = Table.GetRowStruct())
+	{
+		Stats.RowStruct = RowStruct->GetName();
+		Stats.RowStructSize = RowStruct->GetStructureSize();
+		Stats.RowBytes = SIZE_T(Stats.NumRows) * Stats.RowStructSize;
+		for (const TPair<FName, uint8*>& Pair : RowMap)
+		{
+			Stats.RowHeapBytes += DataTableTagMemoryReport::GetStructHeapSize(RowStruct, Pair.Value);
+		}
+		Stats.NumDuplicateRows = DataTableTagMemoryReport::CountDuplicateRows(*RowStruct, RowMap);
+	}
+
+	if (const UDataTableTagIndexSubsystem* IndexSubsystem = UDataTableTagIndexSubsystem::Get())
+	{
+		if (const FDataTableTagIndex* Index = IndexSubsystem->FindExisting(Table))
+		{
+			Stats.IndexBytes = Index->GetAllocatedSize();
+		}
+	}
+	if (const UDataTableTagChangeSubsystem* ChangeSubsystem = UDataTableTagChangeSubsystem::Get())
+	{
+		Stats.CacheBytes = ChangeSubsystem->GetAllocatedSize(Table);
+	}
+	return Stats;
+}
+
+bool FDataTableTagMemoryReport::Sort(TArray<FDataTableTagMemoryStats>& Stats, FStringView Column)
+{
+	using FStats = FDataTableTagMemoryStats;
+	if (Column.Equals(TEXT("Total"), ESearchCase::IgnoreCase))
+	{
+		Stats.Sort([](const FStats& A, const FStats& B) { return A.GetTotalBytes() > B.GetTotalBytes(); });
+	}
+	else if (Column.Equals(TEXT("Rows"), ESearchCase::IgnoreCase))
+	{
+		Stats.Sort([](const FStats& A, const FStats& B) { return A.NumRows > B.NumRows; });
+	}
+	else if (Column.Equals(TEXT("Heap"), ESearchCase::IgnoreCase))
+	{
+		Stats.Sort([](const FStats& A, const FStats& B) { return A.RowHeapBytes > B.RowHeapBytes; });
+	}
+	else if (Column.Equals(TEXT("Index"), ESearchCase::IgnoreCase))
+	{
+		Stats.Sort([](const FStats& A, const FStats& B) { return A.IndexBytes + A.CacheBytes > B.IndexBytes + B.CacheBytes; });
+	}
+	else if (Column.Equals(TEXT("Duplicates"), ESearchCase::IgnoreCase))
+	{
+		Stats.Sort([](const FStats& A, const FStats& B) { return A.NumDuplicateRows > B.NumDuplicateRows; });
+	}
+	else if (Column.Equals(TEXT("Name"), ESearchCase::IgnoreCase))
+	{
+		Stats.Sort([](const FStats& A, const FStats& B) { return A.TablePath < B.TablePath; });
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
+
+void FDataTableTagMemoryReport::Print(TConstArrayView<FDataTableTagMemoryStats> Stats, FOutputDevice& Ar)
+{
+	Ar.Logf(TEXT("%8s %8s %10s %10s %10s %10s %10s %10s %6s  %s"),
+		TEXT("Rows"), TEXT("RowSize"), TEXT("Rows KiB"), TEXT("Heap KiB"), TEXT("Map KiB"), TEXT("Index KiB"), TEXT("Cache KiB"), TEXT("Total KiB"), TEXT("Dups"), TEXT("Table"));
+
+	FDataTableTagMemoryStats Total;
+	for (const FDataTableTagMemoryStats& Table : Stats)
+	{
+		Ar.Logf(TEXT("%8d %8d %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %6d  %s (%s)"),
+			Table.NumRows, Table.RowStructSize, DataTableTagMemoryReport::KiB(Table.RowBytes), DataTableTagMemoryReport::KiB(Table.RowHeapBytes),
+			DataTableTagMemoryReport::KiB(Table.RowMapBytes), DataTableTagMemoryReport::KiB(Table.IndexBytes), DataTableTagMemoryReport::KiB(Table.CacheBytes),
+			DataTableTagMemoryReport::KiB(Table.GetTotalBytes()), Table.NumDuplicateRows, *Table.TablePath, *Table.RowStruct);
+
+		Total.NumRows += Table.NumRows;
+		Total.RowBytes += Table.RowBytes;
+		Total.RowHeapBytes += Table.RowHeapBytes;
+		Total.RowMapBytes += Table.RowMapBytes;
+		Total.IndexBytes += Table.IndexBytes;
+		Total.CacheBytes += Table.CacheBytes;
+		Total.NumDuplicateRows += Table.NumDuplicateRows;
+	}
+
+	Ar.Logf(TEXT("%8d %8s %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %6d  %d table(s)"),
+		Total.NumRows, TEXT(""), DataTableTagMemoryReport::KiB(Total.RowBytes), DataTableTagMemoryReport::KiB(Total.RowHeapBytes),
+		DataTableTagMemoryReport::KiB(Total.RowMapBytes), DataTableTagMemoryReport::KiB(Total.IndexBytes), DataTableTagMemoryReport::KiB(Total.CacheBytes),
+		DataTableTagMemoryReport::KiB(Total.GetTotalBytes()), Total.NumDuplicateRows, Stats.Num());
+}
+
+FString FDataTableTagMemoryReport::ToCsv(TConstArrayView<FDataTableTagMemoryStats> Stats)
+{
+	// Bytes rather than KiB, so builds can be diffed exactly
+	FString Csv = TEXT("Table,RowStruct,Rows,RowStructSize,RowBytes,RowHeapBytes,RowMapBytes,IndexBytes,CacheBytes,TotalBytes,DuplicateRows\n");
+	for (const FDataTableTagMemoryStats& Table : Stats)
+	{
+		Csv.Appendf(TEXT("%s,%s,%d,%d,%llu,%llu,%llu,%llu,%llu,%llu,%d\n"),
+			*Table.TablePath, *Table.RowStruct, Table.NumRows, Table.RowStructSize,
+			uint64(Table.RowBytes), uint64(Table.RowHeapBytes), uint64(Table.RowMapBytes), uint64(Table.IndexBytes), uint64(Table.CacheBytes),
+			uint64(Table.GetTotalBytes()), Table.NumDuplicateRows);
+	}
+	return Csv;
+}
+
+bool FDataTableTagMemoryReport::Run(const TCHAR* Params, FOutputDevice& Ar)
+{
+	TArray<FDataTableTagMemoryStats> Stats;
+	Gather(FParse::Param(Params, TEXT("All")), Stats);
+
+	FString Column = TEXT("Total");
+	FParse::Value(Params, TEXT("Sort="), Column);
+	if (!Sort(Stats, Column))
+	{
+		Ar.Logf(ELogVerbosity::Error, TEXT("Unknown sort column %s; use Total, Rows, Heap, Index, Duplicates or Name"), *Column);
+		return false;
+	}
+
+	Print(Stats, Ar);
+
+	FString CsvPath;
+	if (FParse::Value(Params, TEXT("CSV="), CsvPath))
+	{
+		if (!FFileHelper::SaveStringToFile(ToCsv(Stats), *CsvPath))
+		{
+			Ar.Logf(ELogVerbosity::Error, TEXT("Cannot write %s"), *CsvPath);
+			return false;
+		}
+		Ar.Logf(TEXT("Wrote %s"), *CsvPath);
+	}
+	return true;
+}
@@ -0,0 +1,50 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "DataTableTagMemoryReportCommandlet.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "DataTableGameplayTag.h"
+#include "DataTableTagAssetTags.h"
+#include "DataTableTagIndex.h"
+#include "DataTableTagMemoryReport.h"
+#include "Engine/DataTable.h"
+
+UDataTableTagMemoryReportCommandlet::UDataTableTagMemoryReportCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UDataTableTagMemoryReportCommandlet::Main(const FString& Params)
+{
+	IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+	if (!AssetRegistry)
+	{
+		UE_LOG(LogDataTableGameplayTag, Error, TEXT("The asset registry is not available"));
+		return 1;
+	}
+	AssetRegistry->SearchAllAssets(/*bSynchronousSearch*/true);
+
+	TArray<FAssetData> Assets;
+	AssetRegistry->GetAssetsByClass(UDataTable::StaticClass()->GetClassPathName(), Assets, /*bSearchSubClasses*/true);
+
+	// Tables saved before the tags existed are loaded too; the report drops them if they are not tag-keyed
+	int32 NumLoaded = 0;
+	for (const FAssetData& Asset : Assets)
+	{
+		if (!FDataTableTagAssetTags::IsTagKeyed(Asset).Get(true))
+		{
+			continue;
+		}
+		if (const UDataTable* Table = Cast<UDataTable>(Asset.GetAsset()))
+		{
+			FDataTableTagIndex::Get(*Table);
+			++NumLoaded;
+		}
+	}
+	UE_LOG(LogDataTableGameplayTag, Display, TEXT("DataTableTagMemoryReport: loaded %d table(s)"), NumLoaded);
+
+	return FDataTableTagMemoryReport::Run(*(Params + TEXT(" -All")), *GLog) ? 0 : 1;
+}
@@ -0,0 +1,110 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "DataTableTagRowData.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "DataTableGameplayTag.h"
+#include "DataTableTagAssetTags.h"
+#include "DataTableTagIndex.h"
+#include "Engine/DataTable.h"
+
+namespace DataTableTagRowData
+{
+	/** Bindings of every loaded generated header; filled during static initialization. */
+	TArray<const FDataTableTagRowDataBinding*>& Bindings()
+	{
+		static TArray<const FDataTableTagRowDataBinding*> Registered;
+		return Registered;
+	}
+}
+
+FDataTableTagRowDataBinding::FDataTableTagRowDataBinding(const TCHAR* InTablePath, uint32 InChecksum, int32 InNumRows)
+	: TablePath(InTablePath)
+	, Checksum(InChecksum)
+	, NumRows(InNumRows)
+{
+	DataTableTagRowData::Bindings().Add(this);
+}
+
+FDataTableTagRowDataBinding::~FDataTableTagRowDataBinding()
+{
+	DataTableTagRowData::Bindings().RemoveSingleSwap(this);
+}
+
+uint32 FDataTableTagRowDataBinding::ComputeChecksum(const FDataTableTagIndex& Index)
+{
+	const UScriptStruct* RowStruct = Index.GetRowStruct();
+	if (!RowStruct)
+	{
+		return 0;
+	}
+
+	uint32 Crc = 0;
+	FString Text;
+	for (int32 Row = 0; Row < Index.Num(); ++Row)
+	{
+		Text.Reset();
+		Index.GetRowName(Row).AppendString(Text);
+		Text.AppendChar(TEXT('\n'));
+		RowStruct->ExportText(Text, Index.GetRow(Row), nullptr, nullptr, PPF_None, nullptr);
+		Text.AppendChar(TEXT('\n'));
+		Crc = FCrc::StrCrc32(*Text, Crc);
+	}
+	return Crc;
+}
+
+bool FDataTableTagRowDataBinding::IsBound(const UDataTable& Table)
+{
+	const TArray<const FDataTableTagRowDataBinding*>& Bindings = DataTableTagRowData::Bindings();
+	if (Bindings.Num() == 0)
+	{
+		return false;
+	}
+
+	const FString PathName = Table.GetPathName();
+	return Bindings.ContainsByPredicate([&PathName](const FDataTableTagRowDataBinding* Binding) { return PathName.Equals(Binding->TablePath, ESearchCase::IgnoreCase); });
+}
+
+void FDataTableTagRowDataBinding::ValidateAll()
+{
+	IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+	if (!AssetRegistry)
+	{
+		return;
+	}
+
+	for (const FDataTableTagRowDataBinding* Binding : DataTableTagRowData::Bindings())
+	{
+		// Tables still being discovered by the editor are checked when they are indexed
+		const FAssetData Asset = AssetRegistry->GetAssetByObjectPath(FSoftObjectPath(Binding->TablePath), /*bIncludeOnlyOnDiskAssets*/true);
+		const TOptional<uint32> AssetChecksum = Asset.IsValid() ? FDataTableTagAssetTags::GetRowDataChecksum(Asset) : TOptional<uint32>();
+		if (AssetChecksum.IsSet() && AssetChecksum.GetValue() != Binding->Checksum)
+		{
+			Binding->ReportStale(AssetChecksum.GetValue());
+		}
+	}
+}
+
+void FDataTableTagRowDataBinding::ValidateTable(const UDataTable& Table, const FDataTableTagIndex& Index)
+{
+	if (!IsBound(Table))
+	{
+		return;
+	}
+
+	const uint32 TableChecksum = ComputeChecksum(Index);
+	const FString PathName = Table.GetPathName();
+	for (const FDataTableTagRowDataBinding* Binding : DataTableTagRowData::Bindings())
+	{
+		if (PathName.Equals(Binding->TablePath, ESearchCase::IgnoreCase) && TableChecksum != Binding->Checksum)
+		{
+			Binding->ReportStale(TableChecksum);
+		}
+	}
+}
+
+void FDataTableTagRowDataBinding::ReportStale(uint32 AssetChecksum) const
+{
+	UE_LOG(LogDataTableGameplayTag, Warning, TEXT("Baked rows of %s are stale (%d rows, checksum %08x; asset has checksum %08x). Regenerate the row data header."),
+		TablePath, NumRows, Checksum, AssetChecksum);
+}
@@ -0,0 +1,179 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "DataTableTagRowHandle.h"
+#include "DataTableTagIndex.h"
+#include "DataTableTagIndexSubsystem.h"
+#include "DataTableGameplayTag.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/CoreNet.h"
+
+namespace DataTableTagRowHandle
+{
+	bool bNetRowIndices = true;
+	FAutoConsoleVariableRef CVarNetRowIndices(
+		TEXT("DataTableTag.NetRowIndices"),
+		bNetRowIndices,
+		TEXT("Replicates row references as row indices within their table rather than gameplay tag net indices. Only read by the sender."));
+
+	/** Exclusive bound of the row index width, which is sent in 5 bits. */
+	constexpr uint32 MaxIndexBits = 32;
+
+	uint32 IndexBitsFor(int32 NumRows)
+	{
+		return FMath::CeilLogTwo(static_cast<uint32>(FMath::Max(NumRows, 1)));
+	}
+
+	/** Sent along with indices so tables holding other rows, even as many, are told apart. */
+	constexpr uint32 ChecksumBits = 16;
+
+	uint32 ShortChecksum(const FDataTableTagIndex& Index)
+	{
+		const uint32 Checksum = Index.GetChecksum();
+		return (Checksum ^ (Checksum >> ChecksumBits)) & ((1u << ChecksumBits) - 1);
+	}
+}
+
+const uint8* FDataTableTagRowHandle::Resolve() const
+{
+	if (!Table || !Tag.IsValid())
+	{
+		return nullptr;
+	}
+	if (!IsInGameThread())
+	{
+		return Table->FindRowUnchecked(Tag.GetTagName());
+	}
+
+	const uint32 CurrentGeneration = UDataTableTagIndexSubsystem::GetChangeGeneration();
+	if (Generation == CurrentGeneration && ResolvedTable == Table && ResolvedTag == Tag)
+	{
+		return CachedRow;
+	}
+	if (!UDataTableTagIndexSubsystem::Get())
+	{
+		// Changes are only tracked once the engine is up
+		return Table->FindRowUnchecked(Tag.GetTagName());
+	}
+
+	CachedRow = FDataTableTagIndex::FindRow(*Table, Tag.GetTagName());
+	ResolvedTable = Table;
+	ResolvedTag = Tag;
+	Generation = CurrentGeneration;
+	return CachedRow;
+}
+
+FString FDataTableTagRowHandle::ToDebugString() const
+{
+	return FString::Printf(TEXT("%s[%s]"), Table ? *Table->GetName() : TEXT("None"), *Tag.ToString());
+}
+
+bool FDataTableTagRowHandle::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	UObject* TableObject = const_cast<UDataTable*>(Table.Get());
+	bool bTableMapped = true;
+	if (Map)
+	{
+		// Unmapped references are tracked by the replication layout, which serializes the handle again once the table loads
+		bTableMapped = Map->SerializeObject(Ar, UDataTable::StaticClass(), TableObject);
+	}
+	else
+	{
+		Ar << TableObject;
+	}
+
+	uint8 bIndexed = 0;
+	uint32 IndexBits = 0;
+	uint32 RowIndex = 0;
+	uint32 Checksum = 0;
+	if (Ar.IsSaving() && Map && bTableMapped && Table && Table->IsNameStableForNetworking() && Tag.IsValid() && DataTableTagRowHandle::bNetRowIndices)
+	{
+		const TSharedRef<const FDataTableTagIndex> Index = FDataTableTagIndex::Get(*Table);
+		const int32 Row = Index->IndexOf(Tag.GetTagName());
+		if (Row != INDEX_NONE)
+		{
+			bIndexed = 1;
+			IndexBits = DataTableTagRowHandle::IndexBitsFor(Index->Num());
+			RowIndex = static_cast<uint32>(Row);
+			Checksum = DataTableTagRowHandle::ShortChecksum(*Index);
+		}
+	}
+	Ar.SerializeBits(&bIndexed, 1);
+
+	if (!bIndexed)
+	{
+		Tag.NetSerialize(Ar, Map, bOutSuccess);
+	}
+	else
+	{
+		Ar.SerializeInt(IndexBits, DataTableTagRowHandle::MaxIndexBits);
+		if (IndexBits > 0)
+		{
+			Ar.SerializeInt(RowIndex, 1u << IndexBits);
+		}
+		Ar.SerializeInt(Checksum, 1u << DataTableTagRowHandle::ChecksumBits);
+
+		if (Ar.IsLoading())
+		{
+			Tag = FGameplayTag();
+			if (const UDataTable* LoadedTable = Cast<UDataTable>(TableObject))
+			{
+				const TSharedRef<const FDataTableTagIndex> Index = FDataTableTagIndex::Get(*LoadedTable);
+				if (DataTableTagRowHandle::ShortChecksum(*Index) == Checksum && DataTableTagRowHandle::IndexBitsFor(Index->Num()) == IndexBits
+					&& static_cast<int32>(RowIndex) < Index->Num())
+				{
+					Tag = FGameplayTag::RequestGameplayTag(Index->GetRowName(RowIndex), false);
+				}
+				else
+				{
+					UE_LOG(LogDataTableGameplayTag, Warning, TEXT("Received row %u of %s, which differs from the sender's table (%u index bits, checksum %04x; %d rows, checksum %04x here). Set DataTableTag.NetRowIndices to 0 on the server to replicate tags instead."),
+						RowIndex, *LoadedTable->GetPathName(), IndexBits, Checksum, Index->Num(), DataTableTagRowHandle::ShortChecksum(*Index));
+				}
+			}
+		}
+	}
+
+	if (Ar.IsLoading())
+	{
+		Table = Cast<UDataTable>(TableObject);
+		Invalidate();
+	}
+	return true;
+}
+
+bool FDataTableTagRowHandleArray::Contains(const FDataTableTagRowHandle& Handle) const
+{
+	return Items.ContainsByPredicate([&Handle](const FDataTableTagRowHandleItem& Item) { return Item.Handle == Handle; });
+}
+
+int32 FDataTableTagRowHandleArray::Add(const FDataTableTagRowHandle& Handle)
+{
+	const int32 Index = Items.Emplace(Handle);
+	MarkItemDirty(Items[Index]);
+	return Index;
+}
+
+void FDataTableTagRowHandleArray::Set(int32 Index, const FDataTableTagRowHandle& Handle)
+{
+	Items[Index].Handle = Handle;
+	MarkItemDirty(Items[Index]);
+}
+
+bool FDataTableTagRowHandleArray::Remove(const FDataTableTagRowHandle& Handle)
+{
+	const int32 Index = Items.IndexOfByPredicate([&Handle](const FDataTableTagRowHandleItem& Item) { return Item.Handle == Handle; });
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+	Items.RemoveAtSwap(Index);
+	MarkArrayDirty();
+	return true;
+}
+
+void FDataTableTagRowHandleArray::Reset()
+{
+	Items.Reset();
+	MarkArrayDirty();
+}
@@ -0,0 +1,73 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+
+#if PLATFORM_ALWAYS_HAS_AVX_2
+#include <immintrin.h>
+#endif
+
+/**
+ * Linear scan over packed 32-bit FName comparison indices, 8 keys per step with AVX2 and 4 per step through
+ * the engine vector intrinsics otherwise (SSE on x64, NEON on ARM). Small tables fit in a few cache lines, so
+ * this beats hashing the name.
+ */
+namespace DataTableTagScan
+{
+	/** Key arrays are padded to a multiple of this. */
+	constexpr int32 BlockSize = 8;
+
+	FORCEINLINE uint32 MakeKey(FName Name)
+	{
+		return Name.GetComparisonIndex().ToUnstableInt();
+	}
+
+	/** Pads keys with zeros, which only NAME_None-like names match and which callers reject by index. */
+	FORCEINLINE void Pad(TArray<uint32>& Keys)
+	{
+		Keys.SetNumZeroed(Align(Keys.Num(), BlockSize));
+	}
+
+	/**
+	 * Returns the first index whose key matches and for which IsMatch(Index) holds, or INDEX_NONE. Names that
+	 * only differ by number share a key, so IsMatch gets the final say.
+	 */
+	template <typename PredicateType>
+	FORCEINLINE int32 Find(const uint32* Keys, int32 NumPadded, uint32 Key, PredicateType IsMatch)
+	{
+#if PLATFORM_ALWAYS_HAS_AVX_2
+		const __m256i Needle = _mm256_set1_epi32(static_cast<int32>(Key));
+		for (int32 Block = 0; Block < NumPadded; Block += 8)
+		{
+			const __m256i Lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Keys + Block));
+			uint32 Mask = static_cast<uint32>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(Lanes, Needle))));
+			for (; Mask; Mask &= Mask - 1)
+			{
+				const int32 Index = Block + FMath::CountTrailingZeros(Mask);
+				if (IsMatch(Index))
+				{
+					return Index;
+				}
+			}
+		}
+#else
+		const VectorRegister4Int Needle = VectorIntSet1(static_cast<int32>(Key));
+		for (int32 Block = 0; Block < NumPadded; Block += 4)
+		{
+			const VectorRegister4Int Lanes = VectorIntLoad(Keys + Block);
+			uint32 Mask = VectorMaskBits(VectorCastIntToFloat(VectorIntCompareEQ(Lanes, Needle)));
+			for (; Mask; Mask &= Mask - 1)
+			{
+				const int32 Index = Block + FMath::CountTrailingZeros(Mask);
+				if (IsMatch(Index))
+				{
+					return Index;
+				}
+			}
+		}
+#endif
+		return INDEX_NONE;
+	}
+}
@@ -0,0 +1,18 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("DataTableTag"), STATGROUP_DataTableTag, STATCAT_Advanced);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Scan lookups"), STAT_DataTableTag_ScanLookups, STATGROUP_DataTableTag, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Perfect hash lookups"), STAT_DataTableTag_HashLookups, STATGROUP_DataTableTag, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Map lookups"), STAT_DataTableTag_MapLookups, STATGROUP_DataTableTag, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Redirected lookups"), STAT_DataTableTag_RedirectedLookups, STATGROUP_DataTableTag, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("String lookups"), STAT_DataTableTag_StringLookups, STATGROUP_DataTableTag, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Scanned tables"), STAT_DataTableTag_ScanTables, STATGROUP_DataTableTag, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Perfect hash tables"), STAT_DataTableTag_HashTables, STATGROUP_DataTableTag, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Map tables"), STAT_DataTableTag_MapTables, STATGROUP_DataTableTag, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Index memory"), STAT_DataTableTag_IndexMemory, STATGROUP_DataTableTag, );
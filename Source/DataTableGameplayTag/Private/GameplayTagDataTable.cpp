@@ -0,0 +1,361 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "GameplayTagDataTable.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+#include "DataTableGameplayTag.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagsManager.h"
+#include "UObject/LinkerLoad.h"
+
+namespace GameplayTagDataTable
+{
+	/** Case-insensitive character of a tag name, with the separator ordered before everything else. */
+	static TCHAR SortKey(TCHAR Char)
+	{
+		return Char == TEXT('.') ? TCHAR(1) : FChar::ToLower(Char);
+	}
+
+	/** Hierarchy pre-order: a tag sorts right before its children, which sort before any other tag. */
+	static bool TagLess(FGameplayTag A, FGameplayTag B)
+	{
+		const FNameBuilder NameA(A.GetTagName());
+		const FNameBuilder NameB(B.GetTagName());
+		const int32 Len = FMath::Min(NameA.Len(), NameB.Len());
+		for (int32 Index = 0; Index < Len; ++Index)
+		{
+			const TCHAR CharA = SortKey(NameA.GetData()[Index]);
+			const TCHAR CharB = SortKey(NameB.GetData()[Index]);
+			if (CharA != CharB)
+			{
+				return CharA < CharB;
+			}
+		}
+		return NameA.Len() < NameB.Len();
+	}
+}
+
+bool UGameplayTagDataTable::GetSubtreeRange(FGameplayTag Tag, int32& OutFirst, int32& OutEnd) const
+{
+	OutFirst = OutEnd = 0;
+	if (!Tag.IsValid())
+	{
+		return false;
+	}
+
+	if (const int32* Index = TagToIndex.Find(Tag))
+	{
+		OutFirst = *Index;
+		OutEnd = SubtreeEnds[*Index];
+		return true;
+	}
+
+	// The tag has no row of its own; its children still sort right after where it would be
+	OutFirst = Algo::LowerBound(GetRowTags(), Tag, &GameplayTagDataTable::TagLess);
+
+	int32 Low = OutFirst;
+	int32 High = NumResolved;
+	while (Low < High)
+	{
+		const int32 Mid = Low + (High - Low) / 2;
+		if (RowTags[Mid].MatchesTag(Tag))
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+	OutEnd = Low;
+	return OutEnd > OutFirst;
+}
+
+void UGameplayTagDataTable::GetSubtreeRowTags(FGameplayTag Tag, TArray<FGameplayTag>& OutRowTags) const
+{
+	OutRowTags.Reset();
+
+	int32 First, End;
+	if (GetSubtreeRange(Tag, First, End))
+	{
+		OutRowTags.Append(RowTags.GetData() + First, End - First);
+	}
+}
+
+void UGameplayTagDataTable::GetRowTagsCopy(TArray<FGameplayTag>& OutRowTags) const
+{
+	OutRowTags.Reset(NumResolved);
+	OutRowTags.Append(RowTags.GetData(), NumResolved);
+}
+
+bool UGameplayTagDataTable::CopyFromDataTable(const UDataTable& Table, TArray<FName>* OutSkipped)
+{
+	UScriptStruct* Struct = const_cast<UScriptStruct*>(Table.GetRowStruct());
+	if (!Struct)
+	{
+		UE_LOG(LogDataTableGameplayTag, Warning, TEXT("%s has no row struct; it cannot be copied to %s."), *Table.GetPathName(), *GetPathName());
+		return false;
+	}
+
+	Modify();
+	FreeRows();
+	RowStruct = Struct;
+	RowTags.Reset(Table.GetRowMap().Num());
+
+	TArray<const uint8*> SourceRows;
+	SourceRows.Reserve(Table.GetRowMap().Num());
+	for (const TPair<FName, uint8*>& Pair : Table.GetRowMap())
+	{
+		const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(Pair.Key, /*ErrorIfNotFound*/false);
+		if (Tag.IsValid())
+		{
+			RowTags.Add(Tag);
+			SourceRows.Add(Pair.Value);
+		}
+		else if (OutSkipped)
+		{
+			OutSkipped->Add(Pair.Key);
+		}
+	}
+
+	AllocateRows(*Struct);
+	for (int32 Index = 0; Index < SourceRows.Num(); ++Index)
+	{
+		Struct->CopyScriptStruct(GetMutableRow(Index), SourceRows[Index]);
+	}
+
+	Finalize();
+	return true;
+}
+
+void UGameplayTagDataTable::CopyToDataTable(UDataTable& Table) const
+{
+	Table.Modify();
+	Table.EmptyTable();
+	Table.RowStruct = RowStruct;
+
+	for (int32 Index = 0; Index < RowTags.Num(); ++Index)
+	{
+		Table.AddRow(RowTags[Index].GetTagName(), *reinterpret_cast<const FTableRowBase*>(GetRow(Index)));
+	}
+	Table.HandleDataTableChanged();
+}
+
+SIZE_T UGameplayTagDataTable::GetAllocatedSize() const
+{
+	return SIZE_T(RowStride) * RowTags.Num()
+		+ RowTags.GetAllocatedSize()
+		+ TagToIndex.GetAllocatedSize()
+		+ SubtreeEnds.GetAllocatedSize();
+}
+
+void UGameplayTagDataTable::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	if (Ar.IsLoading())
+	{
+		// A user-defined struct may not be loaded yet, and its size is only known once it is
+		if (RowStruct && RowStruct->HasAnyFlags(RF_NeedLoad))
+		{
+			if (FLinkerLoad* RowStructLinker = RowStruct->GetLinker())
+			{
+				RowStructLinker->Preload(RowStruct);
+			}
+		}
+
+		// Rows of a struct that is gone are still read, to keep the archive in sync, then dropped by Finalize
+		FreeRows();
+		AllocateRows(RowStruct ? *RowStruct : *FTableRowBase::StaticStruct());
+	}
+
+	if (Rows)
+	{
+		UScriptStruct* Struct = const_cast<UScriptStruct*>(RowsStruct);
+		for (int32 Index = 0; Index < RowTags.Num(); ++Index)
+		{
+			Struct->SerializeItem(Ar, GetMutableRow(Index), nullptr);
+		}
+	}
+
+	if (Ar.IsCountingMemory())
+	{
+		Ar.CountBytes(GetAllocatedSize(), GetAllocatedSize());
+	}
+
+	if (Ar.IsLoading())
+	{
+		Finalize();
+	}
+}
+
+void UGameplayTagDataTable::BeginDestroy()
+{
+	// The row struct is still alive here, unlike in the destructor
+	FreeRows();
+	TagToIndex.Empty();
+	SubtreeEnds.Empty();
+
+	Super::BeginDestroy();
+}
+
+void UGameplayTagDataTable::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	UGameplayTagDataTable* This = CastChecked<UGameplayTagDataTable>(InThis);
+	if (This->Rows)
+	{
+		for (int32 Index = 0; Index < This->RowTags.Num(); ++Index)
+		{
+			Collector.AddPropertyReferencesWithStructARO(This->RowsStruct, This->GetMutableRow(Index), This);
+		}
+	}
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
+void UGameplayTagDataTable::FreeRows()
+{
+	if (Rows)
+	{
+		RowsStruct->DestroyStruct(Rows, RowTags.Num());
+		FMemory::Free(Rows);
+	}
+	Rows = nullptr;
+	RowStride = 0;
+	RowsStruct = nullptr;
+}
+
+void UGameplayTagDataTable::AllocateRows(const UScriptStruct& Struct)
+{
+	check(!Rows);
+	RowsStruct = &Struct;
+	RowStride = Align(Struct.GetStructureSize(), Struct.GetMinAlignment());
+	if (RowTags.Num() > 0)
+	{
+		// One block for every row, initialized in one pass
+		Rows = static_cast<uint8*>(FMemory::Malloc(SIZE_T(RowStride) * RowTags.Num(), Struct.GetMinAlignment()));
+		Struct.InitializeStruct(Rows, RowTags.Num());
+	}
+}
+
+void UGameplayTagDataTable::Reorder(TConstArrayView<int32> Order)
+{
+	const UScriptStruct* Struct = RowsStruct;
+	uint8* OldRows = Rows;
+	const int32 OldNum = RowTags.Num();
+	const int32 Stride = RowStride;
+
+	TArray<FGameplayTag> OldTags = MoveTemp(RowTags);
+	RowTags.Reset(Order.Num());
+	for (const int32 OldIndex : Order)
+	{
+		RowTags.Add(OldTags[OldIndex]);
+	}
+
+	Rows = nullptr;
+	AllocateRows(*Struct);
+	for (int32 Index = 0; Index < Order.Num(); ++Index)
+	{
+		Struct->CopyScriptStruct(GetMutableRow(Index), OldRows + SIZE_T(Order[Index]) * Stride);
+	}
+
+	if (OldRows)
+	{
+		Struct->DestroyStruct(OldRows, OldNum);
+		FMemory::Free(OldRows);
+	}
+}
+
+void UGameplayTagDataTable::Finalize()
+{
+	TagToIndex.Reset();
+	SubtreeEnds.Reset();
+	NumResolved = 0;
+
+	if (!RowStruct || RowsStruct != RowStruct)
+	{
+		if (RowTags.Num() > 0)
+		{
+			UE_LOG(LogDataTableGameplayTag, Error, TEXT("%s: the row struct is missing, %d rows were dropped."), *GetPathName(), RowTags.Num());
+		}
+		FreeRows();
+		RowTags.Reset();
+		return;
+	}
+
+	// A tag that is not registered, e.g. one of a game feature that is not active yet, still loads with its
+	// name; its row is kept, so saving the table does not lose it, but is left out of the hierarchy
+	UGameplayTagsManager& Manager = UGameplayTagsManager::Get();
+	TArray<int32> Order;
+	TArray<int32> Unresolved;
+	Order.Reserve(RowTags.Num());
+	for (int32 Index = 0; Index < RowTags.Num(); ++Index)
+	{
+		if (Manager.RequestGameplayTag(RowTags[Index].GetTagName(), /*ErrorIfNotFound*/false).IsValid())
+		{
+			Order.Add(Index);
+		}
+		else
+		{
+			UE_LOG(LogDataTableGameplayTag, Warning, TEXT("%s: %s is not a registered tag; its row is kept but cannot be looked up."), *GetPathName(), *RowTags[Index].ToString());
+			Unresolved.Add(Index);
+		}
+	}
+
+	// Saved tables are already in order, which is checked in one pass before paying for a sort
+	const auto RowLess = [this](int32 A, int32 B) { return GameplayTagDataTable::TagLess(RowTags[A], RowTags[B]); };
+	bool bSorted = true;
+	for (int32 Index = 1; bSorted && Index < Order.Num(); ++Index)
+	{
+		bSorted = !RowLess(Order[Index], Order[Index - 1]);
+	}
+	if (!bSorted)
+	{
+		Algo::StableSort(Order, RowLess);
+	}
+
+	// Tags may have been redirected onto each other since the table was saved; stable sort keeps the first
+	int32 NumKept = 0;
+	for (int32 Index = 0; Index < Order.Num(); ++Index)
+	{
+		if (NumKept > 0 && RowTags[Order[NumKept - 1]] == RowTags[Order[Index]])
+		{
+			UE_LOG(LogDataTableGameplayTag, Warning, TEXT("%s: duplicate row %s was dropped."), *GetPathName(), *RowTags[Order[Index]].ToString());
+			continue;
+		}
+		Order[NumKept++] = Order[Index];
+	}
+	Order.SetNum(NumKept, /*bAllowShrinking*/false);
+	NumResolved = NumKept;
+	Order.Append(Unresolved);
+
+	bool bInOrder = Order.Num() == RowTags.Num();
+	for (int32 Index = 0; bInOrder && Index < Order.Num(); ++Index)
+	{
+		bInOrder = Order[Index] == Index;
+	}
+	if (!bInOrder)
+	{
+		Reorder(Order);
+	}
+
+	const int32 NumRows = NumResolved;
+	TagToIndex.Reserve(NumRows);
+	SubtreeEnds.SetNumUninitialized(NumRows);
+
+	// Rows whose subtree is still open, innermost last
+	TArray<int32, TInlineAllocator<16>> Open;
+	for (int32 Index = 0; Index < NumRows; ++Index)
+	{
+		TagToIndex.Add(RowTags[Index], Index);
+		while (Open.Num() > 0 && !RowTags[Index].MatchesTag(RowTags[Open.Last()]))
+		{
+			SubtreeEnds[Open.Pop(/*bAllowShrinking*/false)] = Index;
+		}
+		Open.Add(Index);
+	}
+	for (const int32 Index : Open)
+	{
+		SubtreeEnds[Index] = NumRows;
+	}
+}
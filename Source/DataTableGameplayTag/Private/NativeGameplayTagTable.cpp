@@ -0,0 +1,96 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "NativeGameplayTagTable.h"
+#include "DataTableGameplayTag.h"
+#include "GameplayTagsManager.h"
+
+namespace NativeGameplayTagTable
+{
+	/** Tables waiting for the tag manager; filled during static initialization. */
+	TArray<FNativeGameplayTagTable*>& PendingTables()
+	{
+		static TArray<FNativeGameplayTagTable*> Tables;
+		return Tables;
+	}
+
+	bool bBound = false;
+
+	/** Set once the manager has finished adding native tags, whether or not this module saw it happen. */
+	bool bDone = false;
+}
+
+FNativeGameplayTagTable::FNativeGameplayTagTable(const TCHAR* const* InTagStrings, int32 InNumTags)
+	: TagStrings(InTagStrings)
+	, NumTags(InNumTags)
+{
+	Tags.SetNum(NumTags);
+
+	if (NativeGameplayTagTable::bDone)
+	{
+		AddLateTags();
+		return;
+	}
+
+	NativeGameplayTagTable::PendingTables().Add(this);
+	if (!NativeGameplayTagTable::bBound)
+	{
+		NativeGameplayTagTable::bBound = true;
+		UGameplayTagsManager::OnLastChanceToAddNativeTags().AddStatic(&FNativeGameplayTagTable::OnLastChanceToAddNativeTags);
+
+		// Runs right away if the manager is already done, i.e. the first table lives in a module loaded late
+		UGameplayTagsManager::CallOrRegister_OnDoneAddingNativeTagsDelegate(
+			FSimpleMulticastDelegate::FDelegate::CreateStatic(&FNativeGameplayTagTable::OnDoneAddingNativeTags));
+	}
+}
+
+FNativeGameplayTagTable::~FNativeGameplayTagTable()
+{
+	NativeGameplayTagTable::PendingTables().RemoveSingleSwap(this);
+}
+
+void FNativeGameplayTagTable::OnLastChanceToAddNativeTags()
+{
+	TArray<FNativeGameplayTagTable*> Tables = MoveTemp(NativeGameplayTagTable::PendingTables());
+	for (FNativeGameplayTagTable* Table : Tables)
+	{
+		Table->AddTags();
+	}
+}
+
+void FNativeGameplayTagTable::OnDoneAddingNativeTags()
+{
+	NativeGameplayTagTable::bDone = true;
+
+	// Only tables that missed the last chance are still pending
+	TArray<FNativeGameplayTagTable*> Tables = MoveTemp(NativeGameplayTagTable::PendingTables());
+	for (FNativeGameplayTagTable* Table : Tables)
+	{
+		Table->AddLateTags();
+	}
+}
+
+void FNativeGameplayTagTable::AddTags()
+{
+	UGameplayTagsManager& Manager = UGameplayTagsManager::Get();
+	for (int32 Index = 0; Index < NumTags; ++Index)
+	{
+		Tags[Index] = Manager.AddNativeGameplayTag(FName(TagStrings[Index]));
+	}
+}
+
+void FNativeGameplayTagTable::AddLateTags()
+{
+	// Adding by name is only allowed before the manager is done; FNativeGameplayTag also handles the late case
+	UGameplayTagsManager& Manager = UGameplayTagsManager::Get();
+	Manager.PushDeferOnGameplayTagTreeChangedBroadcast();
+
+	LateTags.Reserve(NumTags);
+	for (int32 Index = 0; Index < NumTags; ++Index)
+	{
+		const FNativeGameplayTag& Tag = *LateTags.Emplace_GetRef(MakeUnique<FNativeGameplayTag>(
+			UE_PLUGIN_NAME, UE_MODULE_NAME, FName(TagStrings[Index]), FString(), ENativeGameplayTagToken::PRIVATE_USE_MACRO_INSTEAD));
+		Tags[Index] = Tag.GetTag();
+	}
+
+	Manager.PopDeferOnGameplayTagTreeChangedBroadcast();
+}
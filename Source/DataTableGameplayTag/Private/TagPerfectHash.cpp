@@ -0,0 +1,128 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "TagPerfectHash.h"
+#include "DataTableGameplayTag.h"
+
+namespace TagPerfectHash
+{
+	/** Average keys per bucket; small buckets keep the seed search short even with no spare slots. */
+	constexpr uint32 KeysPerBucket = 2;
+
+	/** Upper bound of the seed search of a single bucket. */
+	constexpr uint32 MaxSeed = 1u << 24;
+}
+
+bool FTagPerfectHash::Build(TConstArrayView<uint64> Hashes)
+{
+	Seeds.Reset();
+	NumSlots = static_cast<uint32>(Hashes.Num());
+	if (NumSlots == 0)
+	{
+		return true;
+	}
+
+	// Keys sharing a hash always collide, whatever the seed
+	TSet<uint64> Unique;
+	Unique.Reserve(Hashes.Num());
+	for (const uint64 Hash : Hashes)
+	{
+		bool bDuplicate = false;
+		Unique.Add(Hash, &bDuplicate);
+		if (bDuplicate)
+		{
+			UE_LOG(LogDataTableGameplayTag, Error, TEXT("Cannot build a perfect hash over %u keys: duplicate key hash %016llx"), NumSlots, Hash);
+			NumSlots = 0;
+			return false;
+		}
+	}
+
+	const uint32 NumBuckets = FMath::Max(1u, FMath::DivideAndRoundUp(NumSlots, TagPerfectHash::KeysPerBucket));
+	Seeds.SetNumZeroed(NumBuckets);
+
+	// Bucket members as a linked list over the keys, so building allocates nothing per bucket
+	TArray<int32> BucketHead, BucketSize, NextKey;
+	BucketHead.Init(INDEX_NONE, NumBuckets);
+	BucketSize.SetNumZeroed(NumBuckets);
+	NextKey.SetNumUninitialized(Hashes.Num());
+	for (int32 Key = 0; Key < Hashes.Num(); ++Key)
+	{
+		const uint32 Bucket = DataTableTagBlob::BucketOf(Hashes[Key], NumBuckets);
+		NextKey[Key] = BucketHead[Bucket];
+		BucketHead[Bucket] = Key;
+		++BucketSize[Bucket];
+	}
+
+	// Largest buckets first, while most slots are still free
+	TArray<int32> Order;
+	Order.SetNumUninitialized(NumBuckets);
+	for (uint32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+	{
+		Order[Bucket] = Bucket;
+	}
+	Order.Sort([&BucketSize](int32 A, int32 B) { return BucketSize[A] > BucketSize[B]; });
+
+	TBitArray<> Used(false, NumSlots);
+	TArray<uint32, TInlineAllocator<16>> Slots;
+	for (const int32 Bucket : Order)
+	{
+		if (BucketSize[Bucket] == 0)
+		{
+			break;
+		}
+
+		uint32 Seed = 0;
+		for (; Seed < TagPerfectHash::MaxSeed; ++Seed)
+		{
+			Slots.Reset();
+			bool bFits = true;
+			for (int32 Key = BucketHead[Bucket]; Key != INDEX_NONE && bFits; Key = NextKey[Key])
+			{
+				const uint32 Slot = DataTableTagBlob::SlotOf(Hashes[Key], Seed, NumSlots);
+				bFits = !Used[Slot] && !Slots.Contains(Slot);
+				Slots.Add(Slot);
+			}
+			if (bFits)
+			{
+				break;
+			}
+		}
+
+		if (Seed == TagPerfectHash::MaxSeed)
+		{
+			UE_LOG(LogDataTableGameplayTag, Error, TEXT("Cannot build a perfect hash over %u keys: no seed found for a bucket of %d keys"), NumSlots, BucketSize[Bucket]);
+			Seeds.Reset();
+			NumSlots = 0;
+			return false;
+		}
+
+		Seeds[Bucket] = Seed;
+		for (const uint32 Slot : Slots)
+		{
+			Used[Slot] = true;
+		}
+	}
+	return true;
+}
+
+uint64 FTagPerfectHash::HashTag(FName Tag)
+{
+	TCHAR Buffer[NAME_SIZE];
+	const uint32 Len = Tag.ToString(Buffer);
+	return HashTag(FStringView(Buffer, Len));
+}
+
+uint64 FTagPerfectHash::HashTag(FStringView Tag)
+{
+	// ASCII characters are their own UTF-8 encoding, so the common case needs no conversion
+	uint64 Hash = DataTableTagBlob::HashBasis;
+	for (const TCHAR Char : Tag)
+	{
+		if (Char >= 128)
+		{
+			const FTCHARToUTF8 Utf8(Tag.GetData(), Tag.Len());
+			return DataTableTagBlob::HashTag(std::string_view(Utf8.Get(), Utf8.Length()));
+		}
+		Hash = DataTableTagBlob::HashByte(Hash, static_cast<char>(Char));
+	}
+	return Hash;
+}
@@ -6,6 +6,8 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "GameplayTagContainer.h"
 #include "Blueprint/BlueprintExceptionInfo.h"
+#include "DataTableTagRowHandle.h"
+#include "GameplayTagDataTable.h"
 #include "DataTableGameplayTagFunctionLibrary.generated.h"
 
 class UDataTable;
@@ -26,6 +28,82 @@ public:
 	static bool GetDataTableRowByTag(UDataTable* Table, FGameplayTag Tag, FTableRowBase& OutRow);
 
 	static bool Generic_GetDataTableRowFromName(const UDataTable* Table, FName RowName, void* OutRowPtr);
+
+	/** Get a Row from a GameplayTagDataTable given its tag */
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "DataTable", meta=(CustomStructureParam = "OutRow", BlueprintInternalUseOnly="true"))
+	static bool GetGameplayTagDataTableRow(UGameplayTagDataTable* Table, FGameplayTag Tag, FTableRowBase& OutRow);
+
+	static bool Generic_GetGameplayTagDataTableRow(const UGameplayTagDataTable* Table, FGameplayTag Tag, void* OutRowPtr);
+
+	/**
+	 * Finds a row from a tag given as a string, e.g. from a console command or a remote payload. The string is
+	 * hashed against the table's index as is, so untrusted input never creates names or tags.
+	 */
+	static const uint8* FindRowByTagString(const UDataTable* Table, FStringView TagString);
+
+	template <typename T>
+	static const T* FindRowByTagString(const UDataTable* Table, FStringView TagString)
+	{
+		const UScriptStruct* RowStruct = Table ? Table->GetRowStruct() : nullptr;
+		if (!RowStruct || !RowStruct->IsChildOf(T::StaticStruct()))
+		{
+			return nullptr;
+		}
+		return reinterpret_cast<const T*>(FindRowByTagString(Table, TagString));
+	}
+
+	/** True if the handle refers to an existing row. */
+	UFUNCTION(BlueprintPure, Category = "DataTable", meta = (DisplayName = "Has Row"))
+	static bool DataTableTagRowHandleHasRow(const FDataTableTagRowHandle& Handle);
+
+	/** Copies the row a handle refers to; the row is cached by the handle until its table changes. */
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "DataTable", meta = (CustomStructureParam = "OutRow", ExpandBoolAsExecs = "ReturnValue"))
+	static bool GetDataTableRowFromHandle(const FDataTableTagRowHandle& Handle, FTableRowBase& OutRow);
+
+	static bool Generic_GetDataTableRowFromHandle(const FDataTableTagRowHandle& Handle, void* OutRowPtr);
+
+	DECLARE_FUNCTION(execGetDataTableRowFromHandle)
+	{
+		P_GET_STRUCT_REF(FDataTableTagRowHandle, Handle);
+
+		Stack.StepCompiledIn<FStructProperty>(nullptr);
+		void* OutRowPtr = Stack.MostRecentPropertyAddress;
+
+		P_FINISH;
+		bool bSuccess = false;
+
+		FStructProperty* StructProp = CastField<FStructProperty>(Stack.MostRecentProperty);
+		const UScriptStruct* TableType = Handle.Table ? Handle.Table->GetRowStruct() : nullptr;
+		if (!StructProp || !OutRowPtr)
+		{
+			FBlueprintExceptionInfo ExceptionInfo(
+				EBlueprintExceptionType::AccessViolation,
+				NSLOCTEXT("GetDataTableRowFromHandle", "MissingOutputProperty", "Failed to resolve the output parameter for GetDataTableRowFromHandle.")
+			);
+			FBlueprintCoreDelegates::ThrowScriptException(P_THIS, Stack, ExceptionInfo);
+		}
+		else if (TableType)
+		{
+			UScriptStruct* OutputType = StructProp->Struct;
+			const bool bCompatible = (OutputType == TableType) ||
+				(OutputType->IsChildOf(TableType) && FStructUtils::TheSameLayout(OutputType, TableType));
+			if (bCompatible)
+			{
+				P_NATIVE_BEGIN;
+				bSuccess = Generic_GetDataTableRowFromHandle(Handle, OutRowPtr);
+				P_NATIVE_END;
+			}
+			else
+			{
+				FBlueprintExceptionInfo ExceptionInfo(
+					EBlueprintExceptionType::AccessViolation,
+					NSLOCTEXT("GetDataTableRowFromHandle", "IncompatibleProperty", "Incompatible output parameter; the data table's type is not the same as the return type.")
+				);
+				FBlueprintCoreDelegates::ThrowScriptException(P_THIS, Stack, ExceptionInfo);
+			}
+		}
+		*(bool*)RESULT_PARAM = bSuccess;
+	}
 	
 	/** Based on UDataTableFunctionLibrary::GetDataTableRowFromName */
 	DECLARE_FUNCTION(execGetDataTableRowByTag)
@@ -91,4 +169,56 @@ public:
 		}
 		*(bool*)RESULT_PARAM = bSuccess;
 	}
+
+	DECLARE_FUNCTION(execGetGameplayTagDataTableRow)
+	{
+		P_GET_OBJECT(UGameplayTagDataTable, Table);
+		P_GET_STRUCT(FGameplayTag, Tag);
+
+		Stack.StepCompiledIn<FStructProperty>(nullptr);
+		void* OutRowPtr = Stack.MostRecentPropertyAddress;
+
+		P_FINISH;
+		bool bSuccess = false;
+
+		FStructProperty* StructProp = CastField<FStructProperty>(Stack.MostRecentProperty);
+		const UScriptStruct* TableType = Table ? Table->GetRowStruct() : nullptr;
+		if (!Table)
+		{
+			FBlueprintExceptionInfo ExceptionInfo(
+				EBlueprintExceptionType::AccessViolation,
+				NSLOCTEXT("GetGameplayTagDataTableRow", "MissingTableInput", "Failed to resolve the table input. Be sure the GameplayTagDataTable is valid.")
+			);
+			FBlueprintCoreDelegates::ThrowScriptException(P_THIS, Stack, ExceptionInfo);
+		}
+		else if (!StructProp || !OutRowPtr)
+		{
+			FBlueprintExceptionInfo ExceptionInfo(
+				EBlueprintExceptionType::AccessViolation,
+				NSLOCTEXT("GetGameplayTagDataTableRow", "MissingOutputProperty", "Failed to resolve the output parameter for GetGameplayTagDataTableRow.")
+			);
+			FBlueprintCoreDelegates::ThrowScriptException(P_THIS, Stack, ExceptionInfo);
+		}
+		else if (TableType)
+		{
+			UScriptStruct* OutputType = StructProp->Struct;
+			const bool bCompatible = (OutputType == TableType) ||
+				(OutputType->IsChildOf(TableType) && FStructUtils::TheSameLayout(OutputType, TableType));
+			if (bCompatible)
+			{
+				P_NATIVE_BEGIN;
+				bSuccess = Generic_GetGameplayTagDataTableRow(Table, Tag, OutRowPtr);
+				P_NATIVE_END;
+			}
+			else
+			{
+				FBlueprintExceptionInfo ExceptionInfo(
+					EBlueprintExceptionType::AccessViolation,
+					NSLOCTEXT("GetGameplayTagDataTableRow", "IncompatibleProperty", "Incompatible output parameter; the table's type is not the same as the return type.")
+				);
+				FBlueprintCoreDelegates::ThrowScriptException(P_THIS, Stack, ExceptionInfo);
+			}
+		}
+		*(bool*)RESULT_PARAM = bSuccess;
+	}
 };
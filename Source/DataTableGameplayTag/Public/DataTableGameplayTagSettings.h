@@ -0,0 +1,48 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "UObject/PrimaryAssetId.h"
+
+#include "DataTableGameplayTagSettings.generated.h"
+
+class UDataTable;
+
+/** Runtime settings of tag-keyed data tables. */
+UCLASS(config = Game, defaultconfig, meta = (DisplayName = "Data Table Gameplay Tags"))
+class DATATABLEGAMEPLAYTAG_API UDataTableGameplayTagSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	/** Row indices of tables nobody looked up for this long are released; 0 keeps them until the table is unloaded. */
+	UPROPERTY(config, EditAnywhere, Category = "Index", meta = (ClampMin = "0", Units = "s"))
+	float IndexEvictionTime = 300.f;
+
+	/** Prepares the indices of the tables below whenever a map starts loading, so first lookups do not hitch. */
+	UPROPERTY(config, EditAnywhere, Category = "Prewarm")
+	bool bPrewarmOnMapLoad = true;
+
+	/** Tables loaded and indexed in the background during map loads. */
+	UPROPERTY(config, EditAnywhere, Category = "Prewarm", meta = (EditCondition = "bPrewarmOnMapLoad"))
+	TArray<TSoftObjectPtr<UDataTable>> PrewarmTables;
+
+	/** Asset Manager primary asset types whose data tables are prewarmed as well. */
+	UPROPERTY(config, EditAnywhere, Category = "Prewarm", meta = (EditCondition = "bPrewarmOnMapLoad"))
+	TArray<FPrimaryAssetType> PrewarmPrimaryAssetTypes;
+
+	/**
+	 * Tables whose rows inherit every field they do not override from the row of their closest parent tag. Rows
+	 * are flattened when cooked, and in the editor when their index is built; see FDataTableTagOverrideMask.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Inheritance")
+	TArray<TSoftObjectPtr<UDataTable>> InheritingTables;
+
+#if WITH_EDITOR
+	//~ Begin UObject Interface
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	//~ End UObject Interface
+#endif
+};
@@ -0,0 +1,48 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FAssetData;
+
+/**
+ * Asset registry tags written for every data table when it is saved, so editor tools can tell which tables are
+ * keyed by gameplay tags and which rows they have without loading them. The tags of a loaded table are computed
+ * once and reused until the table changes.
+ */
+class DATATABLEGAMEPLAYTAG_API FDataTableTagAssetTags
+{
+public:
+	/** "True" if every row name is a well-formed gameplay tag, "False" otherwise. */
+	static const FName TagKeyed;
+
+	/** Row names of a tag-keyed table, as written by EncodeRowNames. */
+	static const FName RowTags;
+
+	/** FDataTableTagRowDataBinding checksum, only written for tables whose rows a generated header baked. */
+	static const FName RowDataChecksum;
+
+	/**
+	 * Sorts the names and front-codes them: each is written as the length of the prefix it shares with the
+	 * previous one, a colon and the rest, separated by commas.
+	 */
+	static FString EncodeRowNames(TConstArrayView<FName> RowNames);
+
+	static void DecodeRowNames(FStringView Encoded, TArray<FName>& OutRowNames);
+
+	/** True if the asset was saved as a tag-keyed table; unset if it was saved before these tags existed. */
+	static TOptional<bool> IsTagKeyed(const FAssetData& Asset);
+
+	/** Row names of a tag-keyed table from its asset data; false if there are none. */
+	static bool GetRowNames(const FAssetData& Asset, TArray<FName>& OutRowNames);
+
+	/** Row data checksum the asset was saved with, if any. */
+	static TOptional<uint32> GetRowDataChecksum(const FAssetData& Asset);
+
+#if WITH_EDITOR
+	/** Starts and stops adding the tags to saved data tables. */
+	static void Register();
+	static void Unregister();
+#endif
+};
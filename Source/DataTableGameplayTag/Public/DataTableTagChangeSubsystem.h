@@ -0,0 +1,110 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "DataTableTagChangeSubsystem.generated.h"
+
+class UDataTable;
+
+/** How a row differs from the previous state of its table. */
+enum class EDataTableTagRowChange : uint8
+{
+	Added,
+	Modified,
+	Removed,
+};
+
+DATATABLEGAMEPLAYTAG_API const TCHAR* LexToString(EDataTableTagRowChange Change);
+
+/** Called on the game thread for a row that changed; the row is gone from the table when Removed. */
+DECLARE_DELEGATE_ThreeParams(FOnDataTableTagRowChanged, const UDataTable& /*Table*/, FName /*RowName*/, EDataTableTagRowChange /*Change*/);
+
+/**
+ * Tells systems which rows of a tag-keyed table changed, so live-tuned values can be re-read when they change
+ * instead of every frame. UDataTable::OnDataTableChanged only reports the whole table; here a hash of every row
+ * of a subscribed table is kept, and each change is diffed against it so only the rows that actually differ
+ * are dispatched. Rows of inheriting tables are hashed flattened, so editing a parent also reports the rows
+ * that inherit from it. Game thread only.
+ */
+UCLASS()
+class DATATABLEGAMEPLAYTAG_API UDataTableTagChangeSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Null before the engine is initialized and after it shut down. */
+	static UDataTableTagChangeSubsystem* Get();
+
+	//~ Begin USubsystem Interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	/** Calls back for changes of the row keyed by Tag. */
+	FDelegateHandle Subscribe(const UDataTable& Table, FGameplayTag Tag, FOnDataTableTagRowChanged Callback);
+
+	/** Calls back for changes of the row keyed by Tag and every row below it, e.g. Weapon.Rifle for Weapon. */
+	FDelegateHandle SubscribeSubtree(const UDataTable& Table, FGameplayTag Tag, FOnDataTableTagRowChanged Callback);
+
+	/** Calls back for changes of any row of the table. */
+	FDelegateHandle SubscribeAll(const UDataTable& Table, FOnDataTableTagRowChanged Callback);
+
+	/** Safe to call from a callback; the subscription is not called again, even for the change being dispatched. */
+	void Unsubscribe(FDelegateHandle Handle);
+
+	/** Number of subscriptions across all tables. */
+	int32 NumSubscriptions() const;
+
+	/** Tables with at least one subscription. */
+	void GetTables(TArray<const UDataTable*>& OutTables) const;
+
+	/** Bytes held for the subscriptions and row hashes of a table. */
+	SIZE_T GetAllocatedSize(const UDataTable& Table) const;
+
+	/** Hash of the values of a row, as kept for the diff. */
+	static uint32 HashRow(const UScriptStruct& RowStruct, const uint8* Row);
+
+private:
+	struct FSubscription
+	{
+		FDelegateHandle Handle;
+
+		/** Row name subscribed to; None for every row. */
+		FName TagName;
+		bool bSubtree = false;
+		FOnDataTableTagRowChanged Callback;
+
+		bool Matches(FName RowName) const;
+	};
+
+	struct FTableState
+	{
+		FDelegateHandle ChangedHandle;
+
+		/** Hash of each row as of the last change. */
+		TMap<FName, uint32> RowHashes;
+
+		TArray<FSubscription> Subscriptions;
+	};
+
+	FDelegateHandle AddSubscription(const UDataTable& Table, FName TagName, bool bSubtree, FOnDataTableTagRowChanged Callback);
+	void OnTableChanged(TObjectKey<UDataTable> Key);
+	static void TakeSnapshot(const UDataTable& Table, TMap<FName, uint32>& OutRowHashes);
+	void Unbind(TObjectKey<UDataTable> Key, const FTableState& State);
+
+	/** Drops the state of tables that were collected. */
+	void OnPostGarbageCollect();
+
+	TMap<TObjectKey<UDataTable>, FTableState> Tables;
+
+	/** Subscriptions removed while changes are dispatched, which the dispatch skips; cleared once it ends. */
+	TSet<FDelegateHandle> Unsubscribed;
+	int32 DispatchDepth = 0;
+
+	FDelegateHandle PostGarbageCollectHandle;
+};
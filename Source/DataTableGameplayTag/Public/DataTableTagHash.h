@@ -0,0 +1,51 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "TagPerfectHash.h"
+
+#include "DataTableTagHash.generated.h"
+
+class UDataTable;
+
+/**
+ * Minimal perfect hash over the row names of a data table, built when the table is cooked and saved with it as a
+ * subobject. FDataTableTagIndex uses it instead of a general-purpose map, so a lookup by tag is one hash and a
+ * single compare. It is ignored if the rows no longer match the checksum it was built for.
+ */
+UCLASS()
+class DATATABLEGAMEPLAYTAG_API UDataTableTagHash : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	static const FName SubobjectName;
+
+	/** Hash cooked with a table, or null. */
+	static const UDataTableTagHash* Find(const UDataTable& Table);
+
+#if WITH_EDITOR
+	/** Creates or refreshes the hash subobject of a table; returns null if its row names cannot be hashed. */
+	static UDataTableTagHash* Build(UDataTable& Table);
+#endif
+
+	/** True if built for these rows. */
+	bool Matches(uint32 RowChecksum, int32 NumRows) const
+	{
+		return Checksum == RowChecksum && SlotToRow.Num() == NumRows && Hash.NumSlots == static_cast<uint32>(NumRows);
+	}
+
+	//~ Begin UObject Interface
+	virtual void Serialize(FArchive& Ar) override;
+	//~ End UObject Interface
+
+	FTagPerfectHash Hash;
+
+	/** Row map index of the row in each slot. */
+	TArray<int32> SlotToRow;
+
+	/** FDataTableTagIndex checksum of the row names the hash was built for. */
+	uint32 Checksum = 0;
+};
@@ -0,0 +1,178 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TagPerfectHash.h"
+#include "UObject/StrongObjectPtr.h"
+
+class UDataTable;
+class UDataTableTagHash;
+class UScriptStruct;
+
+/** How an index finds a row by name. */
+enum class EDataTableTagLookup : uint8
+{
+	/** SIMD scan over packed name keys, for small tables. */
+	Scan,
+
+	/** Minimal perfect hash cooked with the table. */
+	PerfectHash,
+
+	/** Name to row map. */
+	Map,
+};
+
+DATATABLEGAMEPLAYTAG_API const TCHAR* LexToString(EDataTableTagLookup Lookup);
+
+/**
+ * Dense view over the rows of a tag-keyed data table, in row map order. Tables inheriting along the tag hierarchy
+ * are flattened in place when cooked, so every lookup of a cooked game sees the same rows. Uncooked, the index
+ * owns flattened copies instead, and lookups that cannot reach the shared index, i.e. before the engine is up
+ * or off the game thread, see the rows as authored.
+ *
+ * Row indices match the ERow constants of a generated row index header for as long as the table's checksum
+ * matches the one the header was generated with, so native code can fetch rows without hashing names.
+ */
+class DATATABLEGAMEPLAYTAG_API FDataTableTagIndex
+{
+public:
+	/** Tables with at least this many rows spread the work of building their index over worker threads. */
+	static constexpr int32 ParallelBuildThreshold = 16384;
+
+	explicit FDataTableTagIndex(const UDataTable& Table);
+
+	/**
+	 * Builds from a table with the hash cooked with it, looked up beforehand, so the index can be built off the
+	 * game thread as long as the table is not modified meanwhile.
+	 */
+	FDataTableTagIndex(const UDataTable& Table, const UDataTableTagHash* CookedHash);
+	~FDataTableTagIndex();
+
+	UE_NONCOPYABLE(FDataTableTagIndex);
+
+	FORCEINLINE int32 Num() const { return Rows.Num(); }
+
+	/** Row at an index, or null if out of range. */
+	FORCEINLINE const uint8* GetRow(int32 Index) const { return Rows.IsValidIndex(Index) ? Rows[Index] : nullptr; }
+
+	FORCEINLINE FName GetRowName(int32 Index) const { return RowNames.IsValidIndex(Index) ? RowNames[Index] : NAME_None; }
+
+	/**
+	 * Index of a row, or INDEX_NONE, using the lookup picked for the table's size. Old names of tags renamed
+	 * through the project's GameplayTagRedirects find the row of their new name at the same cost.
+	 */
+	int32 IndexOf(FName RowName) const;
+
+	/**
+	 * Index of a row by its name as a string, compared case-insensitively like FName, without creating a name.
+	 * The string hash table it uses is built on the first call. Game thread only.
+	 */
+	int32 IndexOfString(FStringView RowName) const;
+
+	/** Number of redirected tag names baked into the lookup. */
+	FORCEINLINE int32 NumRedirects() const { return RedirectNames.Num(); }
+
+	FORCEINLINE EDataTableTagLookup GetLookup() const { return Lookup; }
+
+	/** True if lookups go through a perfect hash cooked with the table rather than a map. */
+	FORCEINLINE bool HasPerfectHash() const { return Lookup == EDataTableTagLookup::PerfectHash; }
+
+	/** Tables with at most this many rows are scanned instead of hashed (DataTableTag.ScanThreshold). */
+	static int32 GetScanThreshold();
+
+	FORCEINLINE uint32 GetChecksum() const { return Checksum; }
+
+	FORCEINLINE const UScriptStruct* GetRowStruct() const { return RowStruct.Get(); }
+
+	/** True if the rows are flattened copies that inherit fields along the tag hierarchy; never for cooked tables. */
+	FORCEINLINE bool IsFlattened() const { return FlattenedRows != nullptr; }
+
+	/** Bytes allocated by the index, including itself. */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Checksum of a row name sequence; shared by the generator and the runtime. Parallel for long sequences. */
+	static uint32 ComputeChecksum(TConstArrayView<FName> RowNames);
+
+	/**
+	 * Shared index of a table, owned by UDataTableTagIndexSubsystem and rebuilt on first use after the table
+	 * changed. Without the subsystem, i.e. before the engine is up, a throwaway index is built. Game thread only.
+	 */
+	static TSharedRef<const FDataTableTagIndex> Get(const UDataTable& Table);
+
+	/** Row of a table by name through its shared index. Game thread only. */
+	static const uint8* FindRow(const UDataTable& Table, FName RowName);
+
+	/** Row of a table by name as a string through its shared index; no name is created. Game thread only. */
+	static const uint8* FindRowByString(const UDataTable& Table, FStringView RowName);
+
+	/**
+	 * Row at a generated index, or null if the table no longer has the rows the index was generated for
+	 * or its rows are not of ExpectedStruct. Game thread only.
+	 */
+	static const uint8* FindRowByIndex(const UDataTable& Table, int32 RowIndex, uint32 ExpectedChecksum, const UScriptStruct* ExpectedStruct = nullptr);
+
+	/** Drops every shared index. */
+	static void ResetCache();
+
+private:
+	TArray<FName> RowNames;
+	TArray<const uint8*> Rows;
+
+	/** Resolves inherited fields into copies of the rows, parents first, and points Rows at them. */
+	void FlattenRows(const UScriptStruct& Struct);
+
+	/** Flattened rows, one struct every FlattenedStride bytes. */
+	uint8* FlattenedRows = nullptr;
+	int32 FlattenedStride = 0;
+
+	/** Kept alive for as long as the flattened rows, which are destroyed with it. */
+	TStrongObjectPtr<UScriptStruct> FlattenedStruct;
+
+	/** Only the structure of the chosen lookup is built. */
+	EDataTableTagLookup Lookup = EDataTableTagLookup::Map;
+	TArray<uint32> ScanKeys;
+	FTagPerfectHash PerfectHash;
+	TArray<int32> SlotToRow;
+	TMap<FName, int32> NameToIndex;
+
+	/** Old tag names resolving to a row, and that row; scanned after the row keys or added to the map. */
+	TArray<FName> RedirectNames;
+	TArray<int32> RedirectRows;
+
+	void BuildStringIndex() const;
+
+	/** Case-insensitive string hash of each row name followed by each redirect name; empty until first used. */
+	mutable TArray<uint32> StringHashes;
+
+	/** Open-addressed table of indices into StringHashes, INDEX_NONE for free slots. */
+	mutable TArray<int32> StringSlots;
+
+	TWeakObjectPtr<const UScriptStruct> RowStruct;
+	uint32 Checksum = 0;
+};
+
+/**
+ * Declared by generated row index headers. Whenever the index of the bound table is built, i.e. on first use
+ * after load and after every change, the table is checked against the generated checksum and stale indices
+ * are reported.
+ */
+class DATATABLEGAMEPLAYTAG_API FDataTableTagIndexBinding
+{
+public:
+	FDataTableTagIndexBinding(const TCHAR* InTablePath, uint32 InChecksum, int32 InNumRows);
+	~FDataTableTagIndexBinding();
+
+	UE_NONCOPYABLE(FDataTableTagIndexBinding);
+
+	/** Logs an error and returns false if the index no longer matches the generated constants. */
+	bool Validate(const FDataTableTagIndex& Index) const;
+
+	/** Validates every binding of a table. */
+	static void ValidateTable(const UDataTable& Table, const FDataTableTagIndex& Index);
+
+private:
+	const TCHAR* TablePath;
+	uint32 Checksum;
+	int32 NumRows;
+};
@@ -0,0 +1,127 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Engine/StreamableManager.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "DataTableTagIndexSubsystem.generated.h"
+
+class FDataTableTagIndex;
+class UDataTable;
+
+/** Broadcast on the game thread when a prewarm finished, with the number of tables it indexed. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnDataTableTagPrewarmed, int32 /*NumTables*/);
+
+/**
+ * Owns the row index of every tag-keyed table for the whole process, so worlds of a server and PIE instances
+ * share one index per table. Indices are reference counted: one that nobody holds and nobody looked up within
+ * UDataTableGameplayTagSettings::IndexEvictionTime is released and rebuilt on next use. Game thread only.
+ */
+UCLASS()
+class DATATABLEGAMEPLAYTAG_API UDataTableTagIndexSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Null before the engine is initialized and after it shut down. */
+	static UDataTableTagIndexSubsystem* Get();
+
+	//~ Begin USubsystem Interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	/** Index of a table, built on first use after load and after every change of the table. */
+	const TSharedPtr<const FDataTableTagIndex>& FindOrBuild(const UDataTable& Table);
+
+	/**
+	 * Loads tables asynchronously and builds their indices on worker threads, in parallel across tables and
+	 * within very large ones, then installs them on the game thread. OnComplete runs and OnPrewarmed broadcasts
+	 * once every table is ready. Prewarmed tables stay loaded until the next prewarm from settings.
+	 */
+	void Prewarm(TArray<FSoftObjectPath> Tables, FSimpleDelegate OnComplete = FSimpleDelegate());
+
+	/** Prewarms the tables and primary asset types of UDataTableGameplayTagSettings; done on every map load. */
+	void PrewarmFromSettings(FSimpleDelegate OnComplete = FSimpleDelegate());
+
+	/** True while a prewarm is loading or building; loading screens can wait for OnPrewarmed. */
+	bool IsPrewarming() const { return NumPrewarming > 0; }
+
+	FOnDataTableTagPrewarmed OnPrewarmed;
+
+	/** Releases indices idle for longer than MaxIdleSeconds that are not held outside; returns how many. */
+	int32 EvictUnused(double MaxIdleSeconds);
+
+	/** Releases every index. */
+	void Reset();
+
+	int32 NumIndices() const { return Entries.Num(); }
+
+	/** Index of a table if one is built, without building it or counting as a use. */
+	const FDataTableTagIndex* FindExisting(const UDataTable& Table) const;
+
+	/** Tables that have an entry, whether or not their index is currently built. */
+	void GetTables(TArray<const UDataTable*>& OutTables) const;
+
+	/**
+	 * Incremented whenever a table with an index changes or an index is released, after which rows cached
+	 * outside the index, as by FDataTableTagRowHandle, must be looked up again.
+	 */
+	static uint32 GetChangeGeneration() { return ChangeGeneration; }
+
+	/** Bytes allocated by every index currently held. */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Logs each index with its table, size and idle time, followed by the total. */
+	void Dump(FOutputDevice& Ar) const;
+
+private:
+	struct FEntry
+	{
+		/** Null once the table changed, rebuilt on next use. */
+		TSharedPtr<const FDataTableTagIndex> Index;
+		FDelegateHandle ChangedHandle;
+
+		/** Value of Now when the index was last looked up. */
+		double LastUsed = 0.0;
+	};
+
+	/** Entry of a table, bound to its change notifications. */
+	FEntry& FindOrAddEntry(const UDataTable& Table);
+
+	bool Tick(float DeltaTime);
+	void OnTableChanged(TObjectKey<UDataTable> Key);
+	void OnPreLoadMap(const FString& MapName);
+
+	/** Indices bake the tag redirects in, so they are all rebuilt when the redirects may have changed. */
+	void OnTagSettingsChanged();
+	void OnPrewarmLoaded(TArray<FSoftObjectPath> Tables, TWeakPtr<FStreamableHandle> WeakHandle, FSimpleDelegate OnComplete);
+	void FinishPrewarm(TConstArrayView<TObjectKey<UDataTable>> Tables, TArray<TSharedPtr<const FDataTableTagIndex>> Indices, uint32 TableChangesAtStart, FSimpleDelegate OnComplete);
+	void Unbind(TObjectKey<UDataTable> Key, const FEntry& Entry);
+
+	TMap<TObjectKey<UDataTable>, FEntry> Entries;
+
+	/** Refreshed by the ticker so lookups do not read the clock. */
+	double Now = 0.0;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle PreLoadMapHandle;
+	FDelegateHandle TagSettingsChangedHandle;
+
+	FStreamableManager StreamableManager;
+
+	/** Keeps prewarmed tables loaded until the next prewarm from settings. */
+	TArray<TSharedPtr<FStreamableHandle>> PrewarmHandles;
+
+	int32 NumPrewarming = 0;
+
+	/** Counts table changes, so indices built in the background for a table changed meanwhile are dropped. */
+	uint32 NumTableChanges = 0;
+
+	/** Starts at 1 so a zero stamp never matches. */
+	static uint32 ChangeGeneration;
+};
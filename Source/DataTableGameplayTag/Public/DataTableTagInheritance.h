@@ -0,0 +1,51 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "DataTableTagInheritance.generated.h"
+
+class FStructProperty;
+class UDataTable;
+class UScriptStruct;
+
+/**
+ * Fields a row sets itself in a table that inherits along the tag hierarchy; every other field is taken from
+ * the closest parent tag that has a row. Rows of structs without a mask override the fields that differ from
+ * the struct's defaults.
+ */
+USTRUCT(BlueprintType)
+struct DATATABLEGAMEPLAYTAG_API FDataTableTagOverrideMask
+{
+	GENERATED_BODY()
+
+	/** Names of the overridden row struct properties. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Inheritance")
+	TArray<FName> Fields;
+};
+
+/**
+ * Flattens the rows of tables listed in UDataTableGameplayTagSettings::InheritingTables, so
+ * Weapon.Rifle.Assault carries every field of Weapon.Rifle and Weapon it does not override. Cooked tables are
+ * saved flattened; in the editor FDataTableTagIndex resolves copies once when it is built and looks them up like
+ * any other row.
+ */
+class DATATABLEGAMEPLAYTAG_API FDataTableTagInheritance
+{
+public:
+	/** True if the table is set to inherit along the tag hierarchy. */
+	static bool IsInheriting(const UDataTable& Table);
+
+	/** Override mask property of a row struct, or null. */
+	static const FStructProperty* FindMaskProperty(const UScriptStruct& RowStruct);
+
+	/** Parent of each row: the row of the closest parent tag, or INDEX_NONE. */
+	static void FindParentRows(TConstArrayView<FName> RowNames, TArray<int32>& OutParents);
+
+	/**
+	 * Copies every field the row does not override from its already flattened parent. Defaults are the row
+	 * struct's defaults, only read for rows without a mask.
+	 */
+	static void InheritFields(const UScriptStruct& RowStruct, const FStructProperty* MaskProperty, const uint8* Defaults, const uint8* Parent, uint8* Row);
+};
@@ -0,0 +1,64 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UDataTable;
+
+/** Memory held by one tag-keyed table and what this plugin keeps for it. */
+struct DATATABLEGAMEPLAYTAG_API FDataTableTagMemoryStats
+{
+	FString TablePath;
+	FString RowStruct;
+	int32 NumRows = 0;
+	int32 RowStructSize = 0;
+
+	/** One allocation per row, of the row struct's size. */
+	SIZE_T RowBytes = 0;
+
+	/** Heap owned by row fields: strings, arrays, sets and maps, recursively. Text and objects are not owned. */
+	SIZE_T RowHeapBytes = 0;
+
+	/** Row map of the table: FName keys and row pointers. */
+	SIZE_T RowMapBytes = 0;
+
+	/** Shared row index, if built. */
+	SIZE_T IndexBytes = 0;
+
+	/** Row hashes and subscriptions of UDataTableTagChangeSubsystem. */
+	SIZE_T CacheBytes = 0;
+
+	/** Rows whose values equal those of an earlier row. */
+	int32 NumDuplicateRows = 0;
+
+	SIZE_T GetTotalBytes() const { return RowBytes + RowHeapBytes + RowMapBytes + IndexBytes + CacheBytes; }
+};
+
+/**
+ * Reports the memory of every loaded table used through this plugin, i.e. indexed or subscribed to, or of every
+ * loaded table keyed by registered gameplay tags. Backs the DataTableTag.MemReport console command and the
+ * DataTableTagMemoryReport commandlet, which take the same options:
+ *
+ *   -All               Every loaded tag-keyed table, not only those used through the plugin.
+ *   -Sort=<Column>     Total (default), Rows, Heap, Index, Duplicates or Name.
+ *   -CSV=<File>        Also writes the report as CSV, e.g. to track it across builds.
+ */
+class DATATABLEGAMEPLAYTAG_API FDataTableTagMemoryReport
+{
+public:
+	/** Measures the tables; game thread only. */
+	static void Gather(bool bAllTables, TArray<FDataTableTagMemoryStats>& OutStats);
+
+	static FDataTableTagMemoryStats Measure(const UDataTable& Table);
+
+	/** Sorts descending by a column, ascending for Name; false if the column is unknown. */
+	static bool Sort(TArray<FDataTableTagMemoryStats>& Stats, FStringView Column);
+
+	static void Print(TConstArrayView<FDataTableTagMemoryStats> Stats, FOutputDevice& Ar);
+
+	static FString ToCsv(TConstArrayView<FDataTableTagMemoryStats> Stats);
+
+	/** Gathers, sorts, prints and exports as requested by the options above. */
+	static bool Run(const TCHAR* Params, FOutputDevice& Ar);
+};
@@ -0,0 +1,29 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "DataTableTagMemoryReportCommandlet.generated.h"
+
+/**
+ * Loads every tag-keyed data table of the project, builds its index and reports the memory of all of them.
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=DataTableTagMemoryReport [-Sort=<Column>] [-CSV=<File>]
+ *
+ * Tables are found through the asset registry tags written when they were saved; see FDataTableTagMemoryReport
+ * for the columns.
+ */
+UCLASS()
+class UDataTableTagMemoryReportCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UDataTableTagMemoryReportCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
@@ -0,0 +1,43 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FDataTableTagIndex;
+class UDataTable;
+
+/**
+ * Declared by generated row data headers, which bake the rows of a tag-keyed table into constexpr arrays. Baked
+ * rows never see later edits of the asset, so they are compared with it at startup, through the checksum saved
+ * in its asset registry tags, and again whenever its index is built. Mismatches are reported as warnings.
+ *
+ * Cooked builds only keep the checksum tag if it is allowed in the CookedTagsAllowList of the asset registry.
+ */
+class DATATABLEGAMEPLAYTAG_API FDataTableTagRowDataBinding
+{
+public:
+	FDataTableTagRowDataBinding(const TCHAR* InTablePath, uint32 InChecksum, int32 InNumRows);
+	~FDataTableTagRowDataBinding();
+
+	UE_NONCOPYABLE(FDataTableTagRowDataBinding);
+
+	/** Checksum of the names and exported values of every row of an index, in row map order. */
+	static uint32 ComputeChecksum(const FDataTableTagIndex& Index);
+
+	/** True if a generated header baked the rows of the table. */
+	static bool IsBound(const UDataTable& Table);
+
+	/** Checks every binding against the checksum its table was saved with; run once the engine is up. */
+	static void ValidateAll();
+
+	/** Checks the bindings of a table against its freshly built index. */
+	static void ValidateTable(const UDataTable& Table, const FDataTableTagIndex& Index);
+
+	const TCHAR* const TablePath;
+	const uint32 Checksum;
+	const int32 NumRows;
+
+private:
+	void ReportStale(uint32 AssetChecksum) const;
+};
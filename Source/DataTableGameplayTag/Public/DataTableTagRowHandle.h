@@ -0,0 +1,148 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagContainer.h"
+#include "Net/Serialization/FastArraySerializer.h"
+
+#include "DataTableTagRowHandle.generated.h"
+
+/**
+ * Reference to a row of a tag-keyed data table. The row is looked up once and cached together with the change
+ * generation of tag-keyed tables, so resolving again is a few compares until a table changes.
+ */
+USTRUCT(BlueprintType)
+struct DATATABLEGAMEPLAYTAG_API FDataTableTagRowHandle
+{
+	GENERATED_BODY()
+
+	FDataTableTagRowHandle() = default;
+
+	FDataTableTagRowHandle(const UDataTable* InTable, FGameplayTag InTag)
+		: Table(InTable)
+		, Tag(InTag)
+	{
+	}
+
+	/** Table holding the row. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DataTable")
+	TObjectPtr<const UDataTable> Table;
+
+	/** Tag naming the row. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DataTable")
+	FGameplayTag Tag;
+
+	bool IsNull() const { return Table == nullptr || !Tag.IsValid(); }
+
+	/** Row the handle refers to, or null. Only cached on the game thread. */
+	const uint8* Resolve() const;
+
+	/** Row the handle refers to, or null if there is none or the table's rows are not of type T. */
+	template <typename T>
+	const T* Resolve() const
+	{
+		const uint8* Row = Resolve();
+		return Row && Table->GetRowStruct() && Table->GetRowStruct()->IsChildOf(T::StaticStruct()) ? reinterpret_cast<const T*>(Row) : nullptr;
+	}
+
+	/** Forgets the cached row; Resolve looks it up again. */
+	void Invalidate() const { Generation = 0; }
+
+	bool operator==(const FDataTableTagRowHandle& Other) const { return Table == Other.Table && Tag == Other.Tag; }
+	bool operator!=(const FDataTableTagRowHandle& Other) const { return !(*this == Other); }
+
+	friend uint32 GetTypeHash(const FDataTableTagRowHandle& Handle)
+	{
+		return HashCombine(GetTypeHash(Handle.Table), GetTypeHash(Handle.Tag));
+	}
+
+	FString ToDebugString() const;
+
+	/**
+	 * Sends the row's index within the table in ceil(log2(rows)) bits, plus a 5 bit width and a 16 bit hash of the
+	 * table's row checksum so a receiver whose table is not loaded yet or has other rows can skip it. Falls back to
+	 * the tag's net index for rows missing from the table, tables the package map cannot reference, or when
+	 * DataTableTag.NetRowIndices is 0 on the sender. A receiver whose table differs cannot recover the tag and
+	 * reads a null handle, so indices are only meant for clients cooked from the same table as the server; turn
+	 * them off for mismatched builds.
+	 */
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+private:
+	/** Table, tag and change generation the cached row was resolved for; generation 0 means never. */
+	mutable const UDataTable* ResolvedTable = nullptr;
+	mutable FGameplayTag ResolvedTag;
+	mutable uint32 Generation = 0;
+	mutable const uint8* CachedRow = nullptr;
+};
+
+template <>
+struct TStructOpsTypeTraits<FDataTableTagRowHandle> : public TStructOpsTypeTraitsBase2<FDataTableTagRowHandle>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true,
+	};
+};
+
+/** Element of FDataTableTagRowHandleArray. */
+USTRUCT(BlueprintType)
+struct DATATABLEGAMEPLAYTAG_API FDataTableTagRowHandleItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	FDataTableTagRowHandleItem() = default;
+
+	explicit FDataTableTagRowHandleItem(const FDataTableTagRowHandle& InHandle)
+		: Handle(InHandle)
+	{
+	}
+
+	UPROPERTY(BlueprintReadOnly, Category = "DataTable")
+	FDataTableTagRowHandle Handle;
+};
+
+/**
+ * Row references replicated as deltas: only added, changed and removed items are sent. Modify it through the
+ * functions below, or call MarkItemDirty / MarkArrayDirty after touching Items directly.
+ */
+USTRUCT(BlueprintType)
+struct DATATABLEGAMEPLAYTAG_API FDataTableTagRowHandleArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "DataTable")
+	TArray<FDataTableTagRowHandleItem> Items;
+
+	int32 Num() const { return Items.Num(); }
+
+	bool Contains(const FDataTableTagRowHandle& Handle) const;
+
+	/** Appends a reference and returns its index. */
+	int32 Add(const FDataTableTagRowHandle& Handle);
+
+	/** Replaces the reference at an index. */
+	void Set(int32 Index, const FDataTableTagRowHandle& Handle);
+
+	/** Removes the first occurrence of a reference, not preserving order; returns false if absent. */
+	bool Remove(const FDataTableTagRowHandle& Handle);
+
+	void Reset();
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FDataTableTagRowHandleItem, FDataTableTagRowHandleArray>(Items, DeltaParms, *this);
+	}
+};
+
+template <>
+struct TStructOpsTypeTraits<FDataTableTagRowHandleArray> : public TStructOpsTypeTraitsBase2<FDataTableTagRowHandleArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
@@ -0,0 +1,152 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UObject/Object.h"
+
+#include "GameplayTagDataTable.generated.h"
+
+class UDataTable;
+
+/**
+ * A table keyed directly by gameplay tags. Rows live in a single allocation, sorted in tag hierarchy pre-order
+ * (a tag before its children, siblings alphabetically), so every subtree is a contiguous range of rows.
+ *
+ * Unlike UDataTable there is no row map: a tag is found through a transient tag-to-index map built on load, and
+ * the rows of a subtree are the range [First, End). Tables are converted from and to data tables whose row names
+ * are tags, which remains the way to author and import rows.
+ *
+ * Rows whose tag is not registered when the table loads, e.g. one of a game feature that is not active yet, are
+ * kept after the others so they are saved again, but cannot be looked up until the table is loaded once more.
+ */
+UCLASS(BlueprintType)
+class DATATABLEGAMEPLAYTAG_API UGameplayTagDataTable : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Structure of each row; inherits from FTableRowBase. */
+	const UScriptStruct* GetRowStruct() const { return RowStruct; }
+
+	/** Number of rows that can be looked up. */
+	int32 Num() const { return NumResolved; }
+
+	/** Number of rows kept for a tag that was not registered on load. */
+	int32 NumUnresolved() const { return RowTags.Num() - NumResolved; }
+
+	/** Tag of a row, in hierarchy order. */
+	FGameplayTag GetRowTag(int32 Index) const { return RowTags[Index]; }
+
+	/** Tags of every row that can be looked up, in hierarchy order. */
+	TConstArrayView<FGameplayTag> GetRowTags() const { return MakeArrayView(RowTags.GetData(), NumResolved); }
+
+	/** Row at an index, in hierarchy order. */
+	const uint8* GetRow(int32 Index) const
+	{
+		check(RowTags.IsValidIndex(Index));
+		return Rows + SIZE_T(Index) * RowStride;
+	}
+
+	/** Index of the row of a tag, INDEX_NONE if it has none. Parents are not searched. */
+	int32 IndexOf(FGameplayTag Tag) const
+	{
+		const int32* Index = TagToIndex.Find(Tag);
+		return Index ? *Index : INDEX_NONE;
+	}
+
+	/** Row of a tag, nullptr if it has none. */
+	const uint8* FindRow(FGameplayTag Tag) const
+	{
+		const int32 Index = IndexOf(Tag);
+		return Index != INDEX_NONE ? GetRow(Index) : nullptr;
+	}
+
+	template <typename T>
+	const T* FindRow(FGameplayTag Tag) const
+	{
+		if (!RowStruct || !RowStruct->IsChildOf(T::StaticStruct()))
+		{
+			return nullptr;
+		}
+		return reinterpret_cast<const T*>(FindRow(Tag));
+	}
+
+	/**
+	 * Range [OutFirst, OutEnd) of the rows of a tag and all its children. The tag itself does not need a row:
+	 * the range of Weapon covers Weapon.Rifle and Weapon.Pistol either way. Returns false if the range is empty.
+	 */
+	bool GetSubtreeRange(FGameplayTag Tag, int32& OutFirst, int32& OutEnd) const;
+
+	/** Rows of a tag and all its children, in hierarchy order. */
+	UFUNCTION(BlueprintCallable, Category = "DataTable")
+	void GetSubtreeRowTags(FGameplayTag Tag, TArray<FGameplayTag>& OutRowTags) const;
+
+	/** Returns the rows of the table as tags, in hierarchy order. */
+	UFUNCTION(BlueprintCallable, Category = "DataTable", meta = (DisplayName = "Get Row Tags"))
+	void GetRowTagsCopy(TArray<FGameplayTag>& OutRowTags) const;
+
+	/**
+	 * Replaces the rows with those of a data table. Rows whose name is not a registered tag are skipped and
+	 * returned in OutSkipped. Returns false, leaving the table untouched, if the data table has no row struct.
+	 */
+	bool CopyFromDataTable(const UDataTable& Table, TArray<FName>* OutSkipped = nullptr);
+
+	/** Replaces the rows of a data table with these, unresolved ones included, named after their tag. */
+	void CopyToDataTable(UDataTable& Table) const;
+
+	/** Memory used by the rows and the lookup structures. */
+	SIZE_T GetAllocatedSize() const;
+
+	//~ Begin UObject Interface
+	virtual void Serialize(FArchive& Ar) override;
+	virtual void BeginDestroy() override;
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+	//~ End UObject Interface
+
+private:
+	/** Destroys and frees every row. */
+	void FreeRows();
+
+	/** Allocates and initializes rows for every tag of RowTags. */
+	void AllocateRows(const UScriptStruct& Struct);
+
+	/** Row at an index, for filling it. */
+	uint8* GetMutableRow(int32 Index) { return const_cast<uint8*>(GetRow(Index)); }
+
+	/** Rearranges the rows so that row i becomes the old row Order[i]; rows left out are destroyed. */
+	void Reorder(TConstArrayView<int32> Order);
+
+	/**
+	 * Drops rows whose tag became duplicated, e.g. after a redirect, moves rows whose tag is not registered
+	 * after the others, restores hierarchy order unless it holds already and rebuilds TagToIndex and SubtreeEnds.
+	 */
+	void Finalize();
+
+	/** Structure to use for each row; must inherit from FTableRowBase. */
+	UPROPERTY(VisibleAnywhere, Category = "DataTable", AssetRegistrySearchable, meta = (DisplayThumbnail = "false"))
+	TObjectPtr<UScriptStruct> RowStruct;
+
+	/** Tag of each row, in hierarchy order, followed by the unresolved rows. */
+	UPROPERTY(VisibleAnywhere, Category = "DataTable")
+	TArray<FGameplayTag> RowTags;
+
+	/** Rows before this one have a registered tag and are in hierarchy order. */
+	int32 NumResolved = 0;
+
+	/** Every row back to back, RowStride bytes apart; serialized after the properties. */
+	uint8* Rows = nullptr;
+
+	/** Distance between two rows: the row struct size rounded up to its alignment. */
+	int32 RowStride = 0;
+
+	/** Struct Rows was initialized with, which may differ from RowStruct while loading a table whose struct is gone. */
+	const UScriptStruct* RowsStruct = nullptr;
+
+	/** Row index of each tag. */
+	TMap<FGameplayTag, int32> TagToIndex;
+
+	/** One past the last row of each row's subtree. */
+	TArray<int32> SubtreeEnds;
+};
@@ -0,0 +1,51 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "NativeGameplayTags.h"
+
+/**
+ * A block of native gameplay tags registered in one pass.
+ *
+ * Replaces one static FNativeGameplayTag per tag in generated code: the generated source holds a single
+ * constexpr array of tag strings and a single instance of this class, and typed accessors in the generated
+ * header index into it. The tags are added to the tag manager when it asks for native tags, so they are
+ * only valid once the manager has finished adding native tags. Tables of modules loaded after that register
+ * each tag as an FNativeGameplayTag, which inserts it into the finished tree like any late native tag.
+ */
+class DATATABLEGAMEPLAYTAG_API FNativeGameplayTagTable
+{
+public:
+	FNativeGameplayTagTable(const TCHAR* const* InTagStrings, int32 InNumTags);
+	~FNativeGameplayTagTable();
+
+	UE_NONCOPYABLE(FNativeGameplayTagTable);
+
+	/** Tag at a generated index. */
+	FORCEINLINE const FGameplayTag& Get(int32 Index) const
+	{
+		checkSlow(Tags.IsValidIndex(Index));
+		return Tags[Index];
+	}
+
+	FORCEINLINE int32 Num() const { return NumTags; }
+
+private:
+	/** Adds every tag of the table to the tag manager. */
+	void AddTags();
+
+	/** Adds the tags of a table created after the manager finished adding native tags (module loaded late). */
+	void AddLateTags();
+
+	static void OnLastChanceToAddNativeTags();
+	static void OnDoneAddingNativeTags();
+
+	const TCHAR* const* TagStrings;
+	int32 NumTags;
+	TArray<FGameplayTag> Tags;
+
+	/** Tags of a late table; they are removed from the manager with the table, when its module unloads. */
+	TArray<TUniquePtr<FNativeGameplayTag>> LateTags;
+};
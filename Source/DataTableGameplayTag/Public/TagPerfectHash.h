@@ -0,0 +1,43 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TagTableBlob.h"
+
+/**
+ * Minimal perfect hash over a fixed set of tags (hash and displace): keys are spread over buckets, and each
+ * bucket gets a seed that sends all its keys to distinct free slots. N keys map to exactly N slots, so a lookup
+ * is one hash, one seed load and a single compare against the key stored in the slot.
+ *
+ * Uses the same functions as TagTableBlob.h so exported blobs and in-engine tables agree.
+ */
+struct DATATABLEGAMEPLAYTAG_API FTagPerfectHash
+{
+	/** One seed per bucket. */
+	TArray<uint32> Seeds;
+
+	/** Number of keys, and of slots. */
+	uint32 NumSlots = 0;
+
+	/** Builds the hash for a set of key hashes; fails if two keys hash the same. */
+	bool Build(TConstArrayView<uint64> Hashes);
+
+	FORCEINLINE bool IsEmpty() const { return NumSlots == 0; }
+
+	/** Slot of a key; only meaningful for keys of the set, so the caller verifies the key stored there. */
+	FORCEINLINE uint32 SlotOf(uint64 Hash) const
+	{
+		const uint32 Bucket = DataTableTagBlob::BucketOf(Hash, Seeds.Num());
+		return DataTableTagBlob::SlotOf(Hash, Seeds[Bucket], NumSlots);
+	}
+
+	/** Hash of a tag or row name, matching DataTableTagBlob::HashTag of its UTF-8 string. */
+	static uint64 HashTag(FName Tag);
+	static uint64 HashTag(FStringView Tag);
+
+	friend FArchive& operator<<(FArchive& Ar, FTagPerfectHash& Hash)
+	{
+		return Ar << Hash.Seeds << Hash.NumSlots;
+	}
+};
@@ -0,0 +1,297 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+// Standalone on purpose: this header only depends on the C++ standard library so tools that do not link the
+// engine can copy it and read exported tables. Keep it that way.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+/**
+ * Binary export of a tag-keyed data table, designed to be memory mapped and read in place.
+ *
+ * Layout, little-endian, every section 8-byte aligned:
+ *   FHeader
+ *   FField[NumFields]       row layout, names in the string pool
+ *   uint32_t[NumBuckets]    perfect hash seeds
+ *   FKey[NumRows]           tag of each slot, in the string pool
+ *   rows                    NumRows * RowStride bytes, row i belongs to slot i
+ *   string pool             UTF-8, not null terminated
+ *
+ * Rows are stored at their perfect hash slot, so a lookup is one hash, one key compare and no probing.
+ *
+ *   DataTableTagBlob::FReader Reader;
+ *   if (Reader.Open(MappedData, MappedSize))
+ *   {
+ *       const DataTableTagBlob::FField* Damage = Reader.FindField("Damage");
+ *       if (const uint8_t* Row = Reader.FindRow("Ability.Fire.Fireball"))
+ *       {
+ *           const float Value = Reader.Get<float>(Row, *Damage);
+ *       }
+ *   }
+ */
+namespace DataTableTagBlob
+{
+	inline constexpr char Magic[4] = { 'D', 'T', 'G', 'B' };
+	inline constexpr uint32_t Version = 1;
+
+	enum class EFieldType : uint32_t
+	{
+		Bool,
+		Int8,
+		UInt8,
+		Int16,
+		UInt16,
+		Int32,
+		UInt32,
+		Int64,
+		UInt64,
+		Float,
+		Double,
+
+		/** FString, FName, FText source or gameplay tag, stored as an FStringRef into the string pool. */
+		String,
+	};
+
+	struct FStringRef
+	{
+		uint32_t Offset;
+		uint32_t Length;
+	};
+
+	struct FHeader
+	{
+		char Magic[4];
+		uint32_t Version;
+		uint32_t NumRows;
+		uint32_t NumBuckets;
+		uint32_t NumFields;
+		uint32_t RowStride;
+		FStringRef RowStruct;
+		uint64_t FieldsOffset;
+		uint64_t SeedsOffset;
+		uint64_t KeysOffset;
+		uint64_t RowsOffset;
+		uint64_t StringsOffset;
+		uint64_t StringsSize;
+		uint64_t TotalSize;
+	};
+
+	struct FField
+	{
+		FStringRef Name;
+		EFieldType Type;
+
+		/** Byte offset within a row. */
+		uint32_t Offset;
+	};
+
+	using FKey = FStringRef;
+
+	static_assert(sizeof(FHeader) == 88, "FHeader layout is part of the format");
+	static_assert(sizeof(FField) == 16, "FField layout is part of the format");
+
+	inline uint32_t FieldSize(EFieldType Type)
+	{
+		switch (Type)
+		{
+		case EFieldType::Bool:
+		case EFieldType::Int8:
+		case EFieldType::UInt8:  return 1;
+		case EFieldType::Int16:
+		case EFieldType::UInt16: return 2;
+		case EFieldType::Int32:
+		case EFieldType::UInt32:
+		case EFieldType::Float:  return 4;
+		case EFieldType::String: return sizeof(FStringRef);
+		default:                 return 8;
+		}
+	}
+
+	inline char ToLowerAscii(char Char)
+	{
+		return Char >= 'A' && Char <= 'Z' ? static_cast<char>(Char - 'A' + 'a') : Char;
+	}
+
+	inline constexpr uint64_t HashBasis = 0xcbf29ce484222325ull;
+
+	/** One FNV-1a step over a byte of the ASCII-lowercased tag. */
+	inline uint64_t HashByte(uint64_t Hash, char Char)
+	{
+		return (Hash ^ static_cast<uint8_t>(ToLowerAscii(Char))) * 0x100000001b3ull;
+	}
+
+	/** FNV-1a over the ASCII-lowercased UTF-8 tag, since tags compare case-insensitively. */
+	inline uint64_t HashTag(std::string_view Tag)
+	{
+		uint64_t Hash = HashBasis;
+		for (const char Char : Tag)
+		{
+			Hash = HashByte(Hash, Char);
+		}
+		return Hash;
+	}
+
+	/** Bucket of a key; uses the high bits so it stays independent of the slot. */
+	inline uint32_t BucketOf(uint64_t Hash, uint32_t NumBuckets)
+	{
+		return static_cast<uint32_t>((Hash >> 32) % NumBuckets);
+	}
+
+	/** Slot of a key once its bucket's seed is known. */
+	inline uint32_t SlotOf(uint64_t Hash, uint32_t Seed, uint32_t NumSlots)
+	{
+		uint64_t X = Hash ^ (static_cast<uint64_t>(Seed) * 0x9e3779b97f4a7c15ull);
+		X ^= X >> 33;
+		X *= 0xff51afd7ed558ccdull;
+		X ^= X >> 33;
+		X *= 0xc4ceb9fe1a85ec53ull;
+		X ^= X >> 33;
+		return static_cast<uint32_t>(X % NumSlots);
+	}
+
+	inline bool EqualsIgnoreCase(std::string_view A, std::string_view B)
+	{
+		if (A.size() != B.size())
+		{
+			return false;
+		}
+		for (size_t Index = 0; Index < A.size(); ++Index)
+		{
+			if (ToLowerAscii(A[Index]) != ToLowerAscii(B[Index]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** Zero-copy view over an exported blob; the memory must outlive the reader. */
+	class FReader
+	{
+	public:
+		/** Validates the header, the section bounds and that every field lies within a row; nothing is copied. */
+		bool Open(const void* InData, size_t InSize)
+		{
+			Data = static_cast<const uint8_t*>(InData);
+			Size = InSize;
+			Header = nullptr;
+
+			if (!Data || Size < sizeof(FHeader) || reinterpret_cast<uintptr_t>(Data) % 8 != 0)
+			{
+				return false;
+			}
+			const FHeader* Candidate = reinterpret_cast<const FHeader*>(Data);
+			if (std::memcmp(Candidate->Magic, Magic, sizeof(Magic)) != 0 || Candidate->Version != Version || Candidate->TotalSize > Size)
+			{
+				return false;
+			}
+			if (Candidate->NumRows > 0 && Candidate->NumBuckets == 0)
+			{
+				return false;
+			}
+			if (!InBounds(Candidate->FieldsOffset, uint64_t(Candidate->NumFields) * sizeof(FField))
+				|| !InBounds(Candidate->SeedsOffset, uint64_t(Candidate->NumBuckets) * sizeof(uint32_t))
+				|| !InBounds(Candidate->KeysOffset, uint64_t(Candidate->NumRows) * sizeof(FKey))
+				|| !InBounds(Candidate->RowsOffset, uint64_t(Candidate->NumRows) * Candidate->RowStride)
+				|| !InBounds(Candidate->StringsOffset, Candidate->StringsSize))
+			{
+				return false;
+			}
+
+			// Get<T> trusts the field offsets, so a corrupt field must not point past its row
+			const FField* CandidateFields = reinterpret_cast<const FField*>(Data + Candidate->FieldsOffset);
+			for (uint32_t Index = 0; Index < Candidate->NumFields; ++Index)
+			{
+				const FField& Field = CandidateFields[Index];
+				if (Field.Type > EFieldType::String || uint64_t(Field.Offset) + FieldSize(Field.Type) > Candidate->RowStride)
+				{
+					return false;
+				}
+			}
+
+			Header = Candidate;
+			Fields = reinterpret_cast<const FField*>(Data + Header->FieldsOffset);
+			Seeds = reinterpret_cast<const uint32_t*>(Data + Header->SeedsOffset);
+			Keys = reinterpret_cast<const FKey*>(Data + Header->KeysOffset);
+			Rows = Data + Header->RowsOffset;
+			Strings = reinterpret_cast<const char*>(Data + Header->StringsOffset);
+			return true;
+		}
+
+		bool IsOpen() const { return Header != nullptr; }
+		uint32_t NumRows() const { return Header ? Header->NumRows : 0; }
+		uint32_t NumFields() const { return Header ? Header->NumFields : 0; }
+		std::string_view RowStruct() const { return Header ? GetString(Header->RowStruct) : std::string_view(); }
+
+		const FField& GetField(uint32_t Index) const { return Fields[Index]; }
+
+		const FField* FindField(std::string_view Name) const
+		{
+			for (uint32_t Index = 0; Index < NumFields(); ++Index)
+			{
+				if (GetString(Fields[Index].Name) == Name)
+				{
+					return &Fields[Index];
+				}
+			}
+			return nullptr;
+		}
+
+		/** Row of a tag, or null. */
+		const uint8_t* FindRow(std::string_view Tag) const
+		{
+			if (!Header || Header->NumRows == 0)
+			{
+				return nullptr;
+			}
+			const uint64_t Hash = HashTag(Tag);
+			const uint32_t Slot = SlotOf(Hash, Seeds[BucketOf(Hash, Header->NumBuckets)], Header->NumRows);
+			return EqualsIgnoreCase(GetString(Keys[Slot]), Tag) ? GetRow(Slot) : nullptr;
+		}
+
+		/** Row and tag by slot, to iterate every row. */
+		const uint8_t* GetRow(uint32_t Slot) const { return Rows + size_t(Slot) * Header->RowStride; }
+		std::string_view GetTag(uint32_t Slot) const { return GetString(Keys[Slot]); }
+
+		template <typename T>
+		T Get(const uint8_t* Row, const FField& Field) const
+		{
+			T Value;
+			std::memcpy(&Value, Row + Field.Offset, sizeof(T));
+			return Value;
+		}
+
+		std::string_view GetString(const uint8_t* Row, const FField& Field) const
+		{
+			return GetString(Get<FStringRef>(Row, Field));
+		}
+
+		std::string_view GetString(FStringRef Ref) const
+		{
+			if (uint64_t(Ref.Offset) + Ref.Length > Header->StringsSize)
+			{
+				return std::string_view();
+			}
+			return std::string_view(Strings + Ref.Offset, Ref.Length);
+		}
+
+	private:
+		bool InBounds(uint64_t Offset, uint64_t Bytes) const
+		{
+			return Offset % 8 == 0 && Offset <= Size && Bytes <= Size - Offset;
+		}
+
+		const uint8_t* Data = nullptr;
+		size_t Size = 0;
+		const FHeader* Header = nullptr;
+		const FField* Fields = nullptr;
+		const uint32_t* Seeds = nullptr;
+		const FKey* Keys = nullptr;
+		const uint8_t* Rows = nullptr;
+		const char* Strings = nullptr;
+	};
+}
@@ -9,12 +9,18 @@ public class DataTableGameplayTagEditor : ModuleRules
         PrivateDependencyModuleNames.AddRange(
             new string[]
             {
+                "AssetRegistry",
                 "Core",
                 "CoreUObject",
+                "DataTableGameplayTag",
+                "DeveloperSettings",
                 "Engine",
                 "GameplayTags",
                 "GameProjectGeneration",
                 "InputCore",
+                "Json",
+                "JsonUtilities",
+                "PropertyEditor",
                 "Slate",
                 "SlateCore",
                 "ToolMenus",
@@ -1,7 +1,13 @@
 ﻿// Copyright 2025 Marco Santini. All rights reserved.
 
 #include "DataTableGameplayTagEditor.h"
+#include "DataTableGameplayTagEditorSettings.h"
+#include "DataTableTagHashCooker.h"
+#include "DataTableTagRowHandleCustomization.h"
+#include "NativeTagAutoRegenerator.h"
+#include "PropertyEditorModule.h"
 #include "STagGenWidget.h"
+#include "TagTableRegistry.h"
 
 #define LOCTEXT_NAMESPACE "FDataTableGameplayTagEditorModule"
 
@@ -25,13 +31,43 @@ void FDataTableGameplayTagEditorModule::StartupModule()
 		}))
 	.SetDisplayName(LOCTEXT("TagGenTabTitle", "Gameplay Tags Generator"))
 	.SetMenuType(ETabSpawnerMenuType::Hidden);
+
+	FPropertyEditorModule& PropertyEditor = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
+	PropertyEditor.RegisterCustomPropertyTypeLayout("DataTableTagRowHandle",
+		FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FDataTableTagRowHandleCustomization::MakeInstance));
+
+	FDataTableTagHashCooker::Register();
+
+	// The commandlet regenerates explicitly
+	if (!IsRunningCommandlet())
+	{
+		AutoRegenerator = MakeShared<FNativeTagAutoRegenerator>();
+		AutoRegenerator->Start();
+	}
 }
 
 void FDataTableGameplayTagEditorModule::ShutdownModule()
 {
+	if (AutoRegenerator.IsValid())
+	{
+		AutoRegenerator->Stop();
+		AutoRegenerator.Reset();
+	}
+
+	FDataTableTagHashCooker::Unregister();
+	FTagTableRegistry::Shutdown();
+	if (FPropertyEditorModule* PropertyEditor = FModuleManager::GetModulePtr<FPropertyEditorModule>("PropertyEditor"))
+	{
+		PropertyEditor->UnregisterCustomPropertyTypeLayout("DataTableTagRowHandle");
+	}
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner("GameplayTagsGenerator");
 }
 
+void FDataTableGameplayTagEditorModule::RememberSettings(const FNativeTagGenEntry& Entry)
+{
+	GetMutableDefault<UDataTableGameplayTagEditorSettings>()->RememberEntry(Entry);
+}
+
 void FDataTableGameplayTagEditorModule::RegisterMenus()
 {
 	FToolMenuOwnerScoped Owner("GameplayTagGenerator");
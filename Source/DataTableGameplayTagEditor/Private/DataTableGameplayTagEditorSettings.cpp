@@ -0,0 +1,21 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "DataTableGameplayTagEditorSettings.h"
+
+const FNativeTagGenEntry* UDataTableGameplayTagEditorSettings::FindEntry(const FSoftObjectPath& Table) const
+{
+	return GeneratedTables.FindByPredicate([&Table](const FNativeTagGenEntry& Entry) { return Entry.Table.ToSoftObjectPath() == Table; });
+}
+
+void UDataTableGameplayTagEditorSettings::RememberEntry(const FNativeTagGenEntry& Entry)
+{
+	if (FNativeTagGenEntry* Existing = GeneratedTables.FindByPredicate([&Entry](const FNativeTagGenEntry& Other) { return Other.Table == Entry.Table; }))
+	{
+		*Existing = Entry;
+	}
+	else
+	{
+		GeneratedTables.Add(Entry);
+	}
+	TryUpdateDefaultConfigFile();
+}
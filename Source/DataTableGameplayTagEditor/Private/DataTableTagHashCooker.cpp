@@ -0,0 +1,162 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "DataTableTagHashCooker.h"
+#include "DataTableGameplayTagEditorSettings.h"
+#include "DataTableTagHash.h"
+#include "DataTableTagIndex.h"
+#include "DataTableTagInheritance.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+#include "UObject/StructOnScope.h"
+#include "UObject/UObjectHash.h"
+
+FDelegateHandle FDataTableTagHashCooker::PreSaveHandle;
+FDelegateHandle FDataTableTagHashCooker::PostSaveHandle;
+
+namespace DataTableTagHashCooker
+{
+	/** Only tables whose every row name is a registered tag are hashed; other tables keep the row map. */
+	bool IsTagKeyed(const UDataTable& Table)
+	{
+		if (Table.GetRowMap().Num() == 0)
+		{
+			return false;
+		}
+		for (const TPair<FName, uint8*>& Pair : Table.GetRowMap())
+		{
+			if (!FGameplayTag::RequestGameplayTag(Pair.Key, /*ErrorIfNotFound*/false).IsValid())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void ForEachTable(UPackage* Package, TFunctionRef<void(UDataTable&)> Func)
+	{
+		TArray<UObject*> Objects;
+		GetObjectsWithPackage(Package, Objects, /*bIncludeNestedObjects*/false);
+		for (UObject* Object : Objects)
+		{
+			if (UDataTable* Table = Cast<UDataTable>(Object))
+			{
+				Func(*Table);
+			}
+		}
+	}
+
+	/** Authored rows of a table being saved flattened, in row map order. */
+	struct FAuthoredRows
+	{
+		TWeakObjectPtr<UDataTable> Table;
+		TArray<TSharedRef<FStructOnScope>> Rows;
+	};
+
+	TArray<FAuthoredRows> AuthoredRows;
+
+	/** Overwrites the rows with their flattened values, keeping the authored ones to restore. */
+	void FlattenForSave(UDataTable& Table)
+	{
+		const UScriptStruct* Struct = Table.GetRowStruct();
+		if (!Struct || Table.GetRowMap().Num() == 0 || !FDataTableTagInheritance::IsInheriting(Table))
+		{
+			return;
+		}
+
+		const FDataTableTagIndex Index(Table, nullptr);
+		if (!Index.IsFlattened())
+		{
+			return;
+		}
+
+		FAuthoredRows& Authored = AuthoredRows.AddDefaulted_GetRef();
+		Authored.Table = &Table;
+		Authored.Rows.Reserve(Index.Num());
+		int32 Row = 0;
+		for (const TPair<FName, uint8*>& Pair : Table.GetRowMap())
+		{
+			const TSharedRef<FStructOnScope> Copy = MakeShared<FStructOnScope>(Struct);
+			Struct->CopyScriptStruct(Copy->GetStructMemory(), Pair.Value);
+			Authored.Rows.Add(Copy);
+			Struct->CopyScriptStruct(Pair.Value, Index.GetRow(Row++));
+		}
+	}
+
+	void RestoreAfterSave(UPackage* Package)
+	{
+		for (int32 Entry = AuthoredRows.Num() - 1; Entry >= 0; --Entry)
+		{
+			UDataTable* Table = AuthoredRows[Entry].Table.Get();
+			if (Table && Table->GetPackage() != Package)
+			{
+				continue;
+			}
+
+			const TArray<TSharedRef<FStructOnScope>>& Rows = AuthoredRows[Entry].Rows;
+			if (Table && Table->GetRowStruct() && Table->GetRowMap().Num() == Rows.Num())
+			{
+				int32 Row = 0;
+				for (const TPair<FName, uint8*>& Pair : Table->GetRowMap())
+				{
+					Table->GetRowStruct()->CopyScriptStruct(Pair.Value, Rows[Row++]->GetStructMemory());
+				}
+			}
+			AuthoredRows.RemoveAtSwap(Entry);
+		}
+	}
+}
+
+void FDataTableTagHashCooker::Register()
+{
+	PreSaveHandle = UPackage::PreSavePackageWithContextEvent.AddStatic(&FDataTableTagHashCooker::OnPreSave);
+	PostSaveHandle = UPackage::PackageSavedWithContextEvent.AddStatic(&FDataTableTagHashCooker::OnPostSave);
+}
+
+void FDataTableTagHashCooker::Unregister()
+{
+	UPackage::PreSavePackageWithContextEvent.Remove(PreSaveHandle);
+	UPackage::PackageSavedWithContextEvent.Remove(PostSaveHandle);
+}
+
+void FDataTableTagHashCooker::OnPreSave(UPackage* Package, FObjectPreSaveContext SaveContext)
+{
+	if (!SaveContext.IsCooking() || !Package)
+	{
+		return;
+	}
+
+	DataTableTagHashCooker::ForEachTable(Package, &DataTableTagHashCooker::FlattenForSave);
+	if (!GetDefault<UDataTableGameplayTagEditorSettings>()->bCookPerfectHash)
+	{
+		return;
+	}
+
+	DataTableTagHashCooker::ForEachTable(Package, [](UDataTable& Table)
+	{
+		if (DataTableTagHashCooker::IsTagKeyed(Table) && !UDataTableTagHash::Build(Table))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Cannot build the perfect hash of %s; it will use the row map"), *Table.GetPathName());
+		}
+	});
+}
+
+void FDataTableTagHashCooker::OnPostSave(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+	if (!SaveContext.IsCooking() || !Package)
+	{
+		return;
+	}
+
+	// Cooking from the editor must not leave flattened rows or the subobject in the editor package
+	DataTableTagHashCooker::RestoreAfterSave(Package);
+	DataTableTagHashCooker::ForEachTable(Package, [](UDataTable& Table)
+	{
+		if (UDataTableTagHash* TagHash = const_cast<UDataTableTagHash*>(UDataTableTagHash::Find(Table)))
+		{
+			TagHash->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
+			TagHash->MarkAsGarbage();
+		}
+	});
+}
@@ -0,0 +1,30 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FObjectPreSaveContext;
+class FObjectPostSaveContext;
+
+/**
+ * Adds a UDataTableTagHash subobject to every tag-keyed data table while it is cooked, so the cooked asset
+ * carries a minimal perfect hash over its frozen row tags. The subobject is removed again after the save so
+ * editor packages never keep it.
+ *
+ * Rows of inheriting tables are flattened in place for the save and restored afterwards, so cooked games read
+ * the inherited values through any lookup, including UDataTable's own.
+ */
+class FDataTableTagHashCooker
+{
+public:
+	static void Register();
+	static void Unregister();
+
+private:
+	static void OnPreSave(UPackage* Package, FObjectPreSaveContext SaveContext);
+	static void OnPostSave(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext);
+
+	static FDelegateHandle PreSaveHandle;
+	static FDelegateHandle PostSaveHandle;
+};
@@ -0,0 +1,191 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "DataTableTagRowHandleCustomization.h"
+#include "DataTableTagRowHandle.h"
+#include "DetailWidgetRow.h"
+#include "Engine/DataTable.h"
+#include "IDetailChildrenBuilder.h"
+#include "DetailLayoutBuilder.h"
+#include "PropertyHandle.h"
+#include "Styling/AppStyle.h"
+#include "Widgets/Images/SImage.h"
+#include "Widgets/Input/SComboButton.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SListView.h"
+
+#define LOCTEXT_NAMESPACE "DataTableTagRowHandleCustomization"
+
+TSharedRef<IPropertyTypeCustomization> FDataTableTagRowHandleCustomization::MakeInstance()
+{
+	return MakeShared<FDataTableTagRowHandleCustomization>();
+}
+
+void FDataTableTagRowHandleCustomization::CustomizeHeader(TSharedRef<IPropertyHandle> PropertyHandle, FDetailWidgetRow& HeaderRow, IPropertyTypeCustomizationUtils& CustomizationUtils)
+{
+	TableHandle = PropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FDataTableTagRowHandle, Table));
+	const TSharedPtr<IPropertyHandle> TagHandle = PropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FDataTableTagRowHandle, Tag));
+	TagNameHandle = TagHandle.IsValid() ? TagHandle->GetChildHandle(TEXT("TagName")) : nullptr;
+	if (!TableHandle.IsValid() || !TagNameHandle.IsValid())
+	{
+		HeaderRow.NameContent()[PropertyHandle->CreatePropertyNameWidget()];
+		return;
+	}
+
+	HeaderRow
+	.NameContent()
+	[
+		PropertyHandle->CreatePropertyNameWidget()
+	]
+	.ValueContent()
+	.MinDesiredWidth(300.f)
+	.MaxDesiredWidth(0.f)
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			TableHandle->CreatePropertyValueWidget()
+		]
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0.f, 2.f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			[
+				SAssignNew(RowButton, SComboButton)
+				.IsEnabled_Lambda([this] { return GetTable() != nullptr; })
+				.OnGetMenuContent(this, &FDataTableTagRowHandleCustomization::MakeRowPicker)
+				.ButtonContent()
+				[
+					SNew(STextBlock)
+					.Text(this, &FDataTableTagRowHandleCustomization::GetRowText)
+					.Font(IDetailLayoutBuilder::GetDetailFont())
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(4.f, 0.f, 0.f, 0.f)
+			[
+				SNew(SImage)
+				.Image(FAppStyle::GetBrush("Icons.Warning"))
+				.ToolTipText(LOCTEXT("MissingRow", "The table has no row with this tag."))
+				.Visibility(this, &FDataTableTagRowHandleCustomization::GetMissingRowVisibility)
+			]
+		]
+	];
+}
+
+void FDataTableTagRowHandleCustomization::CustomizeChildren(TSharedRef<IPropertyHandle> PropertyHandle, IDetailChildrenBuilder& ChildBuilder, IPropertyTypeCustomizationUtils& CustomizationUtils)
+{
+}
+
+const UDataTable* FDataTableTagRowHandleCustomization::GetTable() const
+{
+	UObject* Object = nullptr;
+	return TableHandle.IsValid() && TableHandle->GetValue(Object) == FPropertyAccess::Success ? Cast<UDataTable>(Object) : nullptr;
+}
+
+bool FDataTableTagRowHandleCustomization::GetRowName(FName& OutRowName) const
+{
+	return TagNameHandle.IsValid() && TagNameHandle->GetValue(OutRowName) == FPropertyAccess::Success;
+}
+
+TSharedRef<SWidget> FDataTableTagRowHandleCustomization::MakeRowPicker()
+{
+	AllRows.Reset();
+	if (const UDataTable* Table = GetTable())
+	{
+		TArray<FName> RowNames = Table->GetRowNames();
+		RowNames.Sort(FNameLexicalLess());
+		for (const FName RowName : RowNames)
+		{
+			AllRows.Add(MakeShared<FName>(RowName));
+		}
+	}
+	FilteredRows = AllRows;
+
+	return SNew(SBox)
+		.MaxDesiredHeight(400.f)
+		.MinDesiredWidth(300.f)
+		[
+			SNew(SVerticalBox)
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(4.f)
+			[
+				SNew(SSearchBox)
+				.OnTextChanged(this, &FDataTableTagRowHandleCustomization::FilterRows)
+			]
+			+ SVerticalBox::Slot()
+			.FillHeight(1.f)
+			[
+				SAssignNew(RowList, SListView<TSharedPtr<FName>>)
+				.ListItemsSource(&FilteredRows)
+				.SelectionMode(ESelectionMode::Single)
+				.OnGenerateRow(this, &FDataTableTagRowHandleCustomization::MakeRowWidget)
+				.OnSelectionChanged(this, &FDataTableTagRowHandleCustomization::OnRowPicked)
+			]
+		];
+}
+
+void FDataTableTagRowHandleCustomization::FilterRows(const FText& Filter)
+{
+	const FString FilterString = Filter.ToString();
+	FilteredRows.Reset();
+	for (const TSharedPtr<FName>& Row : AllRows)
+	{
+		if (FilterString.IsEmpty() || Row->ToString().Contains(FilterString))
+		{
+			FilteredRows.Add(Row);
+		}
+	}
+	if (RowList.IsValid())
+	{
+		RowList->RequestListRefresh();
+	}
+}
+
+TSharedRef<ITableRow> FDataTableTagRowHandleCustomization::MakeRowWidget(TSharedPtr<FName> Row, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow<TSharedPtr<FName>>, OwnerTable)
+		[
+			SNew(STextBlock).Text(FText::FromName(*Row))
+		];
+}
+
+void FDataTableTagRowHandleCustomization::OnRowPicked(TSharedPtr<FName> Row, ESelectInfo::Type SelectInfo)
+{
+	if (Row.IsValid() && SelectInfo != ESelectInfo::Direct)
+	{
+		TagNameHandle->SetValue(*Row);
+		if (RowButton.IsValid())
+		{
+			RowButton->SetIsOpen(false);
+		}
+	}
+}
+
+FText FDataTableTagRowHandleCustomization::GetRowText() const
+{
+	FName RowName;
+	if (!GetRowName(RowName))
+	{
+		return LOCTEXT("MultipleValues", "Multiple Values");
+	}
+	return RowName.IsNone() ? LOCTEXT("NoRow", "None") : FText::FromName(RowName);
+}
+
+EVisibility FDataTableTagRowHandleCustomization::GetMissingRowVisibility() const
+{
+	const UDataTable* Table = GetTable();
+	FName RowName;
+	const bool bMissing = Table && GetRowName(RowName) && !RowName.IsNone() && !Table->GetRowMap().Contains(RowName);
+	return bMissing ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+#undef LOCTEXT_NAMESPACE
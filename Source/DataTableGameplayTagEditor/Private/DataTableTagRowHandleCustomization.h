@@ -0,0 +1,45 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IPropertyTypeCustomization.h"
+
+class IPropertyHandle;
+class UDataTable;
+template <typename ItemType> class SListView;
+class ITableRow;
+class STableViewBase;
+class SComboButton;
+
+/** Shows FDataTableTagRowHandle as a table picker followed by a searchable list of the table's rows. */
+class FDataTableTagRowHandleCustomization : public IPropertyTypeCustomization
+{
+public:
+	static TSharedRef<IPropertyTypeCustomization> MakeInstance();
+
+	//~ Begin IPropertyTypeCustomization Interface
+	virtual void CustomizeHeader(TSharedRef<IPropertyHandle> PropertyHandle, FDetailWidgetRow& HeaderRow, IPropertyTypeCustomizationUtils& CustomizationUtils) override;
+	virtual void CustomizeChildren(TSharedRef<IPropertyHandle> PropertyHandle, IDetailChildrenBuilder& ChildBuilder, IPropertyTypeCustomizationUtils& CustomizationUtils) override;
+	//~ End IPropertyTypeCustomization Interface
+
+private:
+	const UDataTable* GetTable() const;
+	bool GetRowName(FName& OutRowName) const;
+
+	TSharedRef<SWidget> MakeRowPicker();
+	void FilterRows(const FText& Filter);
+	TSharedRef<ITableRow> MakeRowWidget(TSharedPtr<FName> Row, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnRowPicked(TSharedPtr<FName> Row, ESelectInfo::Type SelectInfo);
+
+	FText GetRowText() const;
+	EVisibility GetMissingRowVisibility() const;
+
+	TSharedPtr<IPropertyHandle> TableHandle;
+	TSharedPtr<IPropertyHandle> TagNameHandle;
+
+	TSharedPtr<SComboButton> RowButton;
+	TSharedPtr<SListView<TSharedPtr<FName>>> RowList;
+	TArray<TSharedPtr<FName>> AllRows;
+	TArray<TSharedPtr<FName>> FilteredRows;
+};
@@ -0,0 +1,1428 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "GameplayTagCodeGenerator.h"
+#include "Async/ParallelFor.h"
+#include "DataTableTagIndex.h"
+#include "DataTableTagInheritance.h"
+#include "DataTableTagRowData.h"
+#include "Engine/DataTable.h"
+#include "GameProjectUtils.h"
+#include "GameplayTagsManager.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Hash/xxhash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Templates/UniquePtr.h"
+
+namespace TagCodeGen
+{
+	static constexpr TCHAR HeaderTpl[] = TEXT("#pragma once\n\n#include \"NativeGameplayTags.h\"\n\nnamespace %s\n{\n");
+	static constexpr TCHAR SourceTpl[] = TEXT("#include \"%s\"\n\nnamespace %s\n{\n");
+	static constexpr TCHAR Epilogue[] = TEXT("}\n");
+
+	static constexpr TCHAR DeclarePrefix[] = TEXT("\tUE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_");
+	static constexpr TCHAR DeclareSuffix[] = TEXT(");\n");
+	static constexpr TCHAR DefinePrefix[] = TEXT("\tUE_DEFINE_GAMEPLAY_TAG(TAG_");
+	static constexpr TCHAR DefineMiddle[] = TEXT(", \"");
+	static constexpr TCHAR DefineSuffix[] = TEXT("\");\n");
+
+	// Bulk registration: one FNativeGameplayTagTable per file instead of one FNativeGameplayTag per tag
+	static constexpr TCHAR BulkHeaderTpl[] = TEXT(
+		"#pragma once\n\n#include \"NativeGameplayTagTable.h\"\n\nnamespace %s\n{\n"
+		"\tnamespace %s\n\t{\n"
+		"\t\tenum class ETag : int32\n\t\t{\n");
+	static constexpr TCHAR BulkHeaderMiddleTpl[] = TEXT(
+		"\t\t\tCount\n\t\t};\n\n"
+		"\t\textern FNativeGameplayTagTable Table;\n\n"
+		"\t\tFORCEINLINE const FGameplayTag& Get(ETag Tag) { return Table.Get(static_cast<int32>(Tag)); }\n"
+		"\t}\n\n");
+	static constexpr TCHAR BulkSourceTpl[] = TEXT(
+		"#include \"%s\"\n\nnamespace %s\n{\n"
+		"\tnamespace %s\n\t{\n"
+		"\t\tstatic constexpr const TCHAR* TagStrings[] =\n\t\t{\n");
+	static constexpr TCHAR BulkSourceEpilogue[] = TEXT(
+		"\t\t};\n"
+		"\t\tstatic_assert(UE_ARRAY_COUNT(TagStrings) == static_cast<SIZE_T>(ETag::Count), \"Generated tag table is out of sync with its header\");\n\n"
+		"\t\tFNativeGameplayTagTable Table(TagStrings, static_cast<int32>(ETag::Count));\n"
+		"\t}\n}\n");
+	static constexpr TCHAR BulkSourceEmptyTpl[] = TEXT(
+		"#include \"%s\"\n\nnamespace %s\n{\n"
+		"\tnamespace %s\n\t{\n"
+		"\t\tFNativeGameplayTagTable Table(nullptr, 0);\n"
+		"\t}\n}\n");
+
+	static constexpr TCHAR EnumPrefix[] = TEXT("\t\t\t");
+
+	// Prefixed like the accessors, so a tag named Count or starting with a digit still gives a valid, unique enumerator
+	static constexpr TCHAR TagEnumPrefix[] = TEXT("\t\t\tTAG_");
+	static constexpr TCHAR EnumSuffix[] = TEXT(",\n");
+	static constexpr TCHAR AccessorPrefix[] = TEXT("\tFORCEINLINE const FGameplayTag& TAG_");
+	static constexpr TCHAR AccessorMiddle[] = TEXT("() { return ");
+	static constexpr TCHAR AccessorEnum[] = TEXT("::ETag::TAG_");
+	static constexpr TCHAR AccessorSuffix[] = TEXT("); }\n");
+	static constexpr TCHAR StringPrefix[] = TEXT("\t\t\tTEXT(\"");
+	static constexpr TCHAR StringSuffix[] = TEXT("\"),\n");
+
+	template <int32 N>
+	constexpr int32 Len(const TCHAR (&)[N]) { return N - 1; }
+
+	int32 NumRowChunks(int32 NumTags)
+	{
+		return FMath::DivideAndRoundUp(NumTags, FGameplayTagCodeGenerator::RowsPerChunk);
+	}
+
+	/** Reserves room for Tags.Num() rows of fixed overhead plus TagCopies copies of each tag. */
+	void ReserveRows(FString& Out, TConstArrayView<FName> Tags, int32 Overhead, int32 TagCopies)
+	{
+		int32 Size = 0;
+		for (const FName Tag : Tags)
+		{
+			Size += Overhead + TagCopies * static_cast<int32>(Tag.GetStringLength());
+		}
+		Out.Reserve(Size);
+	}
+
+	/** Formats the rows [FirstIndex, FirstIndex + NumRows) of a row section. */
+	using FRowFormatter = TFunction<void(int32 /*FirstIndex*/, int32 /*NumRows*/, FString& /*Out*/)>;
+
+	/** Either fixed text or rows formatted chunk by chunk. */
+	struct FSection
+	{
+		FString Text;
+		FRowFormatter Rows;
+	};
+
+	FSection Text(FString InText)
+	{
+		return FSection{ MoveTemp(InText), FRowFormatter() };
+	}
+
+	FSection Rows(FRowFormatter InRows)
+	{
+		return FSection{ FString(), MoveTemp(InRows) };
+	}
+
+	/** Row section with one row per tag. */
+	FSection TagRows(TConstArrayView<FName> Tags, void (*Format)(TConstArrayView<FName>, FString&))
+	{
+		return Rows([Tags, Format](int32 FirstIndex, int32 NumRows, FString& Out) { Format(Tags.Slice(FirstIndex, NumRows), Out); });
+	}
+
+	struct FFilePlan
+	{
+		FGeneratedTagFile* File = nullptr;
+		TArray<FSection> Sections;
+
+		/** Rows of every row section of this file. */
+		int32 NumRows = 0;
+	};
+
+	EParallelForFlags ParallelFlags(int32 NumTasks)
+	{
+		return NumTasks > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+	}
+
+	/** Lays out the chunks of every planned file, then formats all row chunks of all files in a single ParallelFor. */
+	void Assemble(TArrayView<FFilePlan> Plans)
+	{
+		struct FTask
+		{
+			const FRowFormatter* Rows;
+			int32 FirstIndex;
+			int32 NumRows;
+			FString* Out;
+		};
+
+		TArray<FTask> Tasks;
+		for (FFilePlan& Plan : Plans)
+		{
+			const int32 NumChunks = NumRowChunks(Plan.NumRows);
+			int32 NumFileChunks = 0;
+			for (const FSection& Section : Plan.Sections)
+			{
+				NumFileChunks += Section.Rows ? NumChunks : 1;
+			}
+
+			// Sized up front so the task pointers stay valid
+			TArray<FString>& Chunks = Plan.File->Chunks;
+			Chunks.Reset();
+			Chunks.SetNum(NumFileChunks);
+
+			int32 Slot = 0;
+			for (FSection& Section : Plan.Sections)
+			{
+				if (!Section.Rows)
+				{
+					Chunks[Slot++] = MoveTemp(Section.Text);
+					continue;
+				}
+				for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+				{
+					const int32 FirstIndex = ChunkIndex * FGameplayTagCodeGenerator::RowsPerChunk;
+					const int32 NumRows = FMath::Min(FGameplayTagCodeGenerator::RowsPerChunk, Plan.NumRows - FirstIndex);
+					Tasks.Add({ &Section.Rows, FirstIndex, NumRows, &Chunks[Slot++] });
+				}
+			}
+		}
+
+		ParallelFor(Tasks.Num(), [&](int32 TaskIndex)
+		{
+			const FTask& Task = Tasks[TaskIndex];
+			(*Task.Rows)(Task.FirstIndex, Task.NumRows, *Task.Out);
+		}, ParallelFlags(Tasks.Num()));
+	}
+
+	void FormatDeclarations(TConstArrayView<FName> Tags, FString& Out)
+	{
+		ReserveRows(Out, Tags, Len(DeclarePrefix) + Len(DeclareSuffix), 1);
+		for (const FName Tag : Tags)
+		{
+			Out.Append(DeclarePrefix, Len(DeclarePrefix));
+			FGameplayTagCodeGenerator::AppendIdentifier(Out, Tag);
+			Out.Append(DeclareSuffix, Len(DeclareSuffix));
+		}
+	}
+
+	void FormatDefinitions(TConstArrayView<FName> Tags, FString& Out)
+	{
+		ReserveRows(Out, Tags, Len(DefinePrefix) + Len(DefineMiddle) + Len(DefineSuffix), 2);
+		for (const FName Tag : Tags)
+		{
+			Out.Append(DefinePrefix, Len(DefinePrefix));
+			FGameplayTagCodeGenerator::AppendIdentifier(Out, Tag);
+			Out.Append(DefineMiddle, Len(DefineMiddle));
+			Tag.AppendString(Out);
+			Out.Append(DefineSuffix, Len(DefineSuffix));
+		}
+	}
+
+	void FormatEnumEntries(TConstArrayView<FName> Tags, FString& Out)
+	{
+		ReserveRows(Out, Tags, Len(TagEnumPrefix) + Len(EnumSuffix), 1);
+		for (const FName Tag : Tags)
+		{
+			Out.Append(TagEnumPrefix, Len(TagEnumPrefix));
+			FGameplayTagCodeGenerator::AppendIdentifier(Out, Tag);
+			Out.Append(EnumSuffix, Len(EnumSuffix));
+		}
+	}
+
+	void FormatTagStrings(TConstArrayView<FName> Tags, FString& Out)
+	{
+		ReserveRows(Out, Tags, Len(StringPrefix) + Len(StringSuffix), 1);
+		for (const FName Tag : Tags)
+		{
+			Out.Append(StringPrefix, Len(StringPrefix));
+			Tag.AppendString(Out);
+			Out.Append(StringSuffix, Len(StringSuffix));
+		}
+	}
+
+	FSection AccessorRows(TConstArrayView<FName> Tags, const FString& DetailNS)
+	{
+		return Rows([Tags, DetailNS](int32 FirstIndex, int32 NumRows, FString& Out)
+		{
+			const TConstArrayView<FName> Chunk = Tags.Slice(FirstIndex, NumRows);
+			ReserveRows(Out, Chunk, Len(AccessorPrefix) + Len(AccessorMiddle) + Len(AccessorEnum) + Len(AccessorSuffix) + 2 * DetailNS.Len() + 5, 2);
+			for (const FName Tag : Chunk)
+			{
+				Out.Append(AccessorPrefix, Len(AccessorPrefix));
+				FGameplayTagCodeGenerator::AppendIdentifier(Out, Tag);
+				Out.Append(AccessorMiddle, Len(AccessorMiddle));
+				Out.Append(DetailNS);
+				Out.Append(TEXT("::Get("));
+				Out.Append(DetailNS);
+				Out.Append(AccessorEnum, Len(AccessorEnum));
+				FGameplayTagCodeGenerator::AppendIdentifier(Out, Tag);
+				Out.Append(AccessorSuffix, Len(AccessorSuffix));
+			}
+		});
+	}
+
+	FString SanitizeIdentifier(FStringView Name)
+	{
+		FString Out(Name);
+		for (TCHAR& Char : Out.GetCharArray())
+		{
+			if (Char != TEXT('\0') && !FChar::IsAlnum(Char) && Char != TEXT('_'))
+			{
+				Char = TEXT('_');
+			}
+		}
+		return Out;
+	}
+
+	/** Namespace holding the per-file table and enum in bulk mode, unique per file so shards can share a namespace. */
+	FString DetailNamespace(const FTagGenSettings& Settings)
+	{
+		return SanitizeIdentifier(Settings.FileStem) + TEXT("_Private");
+	}
+
+	void PlanHeader(TConstArrayView<FName> Tags, const FTagGenSettings& Settings, FFilePlan& Plan)
+	{
+		Plan.NumRows = Tags.Num();
+		if (Settings.Registration == ETagGenRegistration::BulkTable)
+		{
+			const FString DetailNS = DetailNamespace(Settings);
+			Plan.Sections.Add(Text(FString::Printf(BulkHeaderTpl, *Settings.Namespace, *DetailNS)));
+			Plan.Sections.Add(TagRows(Tags, &FormatEnumEntries));
+			Plan.Sections.Add(Text(BulkHeaderMiddleTpl));
+			Plan.Sections.Add(AccessorRows(Tags, DetailNS));
+			Plan.Sections.Add(Text(Epilogue));
+			return;
+		}
+
+		Plan.Sections.Add(Text(FString::Printf(HeaderTpl, *Settings.Namespace)));
+		Plan.Sections.Add(TagRows(Tags, &FormatDeclarations));
+		Plan.Sections.Add(Text(Epilogue));
+	}
+
+	void PlanSource(TConstArrayView<FName> Tags, const FTagGenSettings& Settings, const FString& HeaderInclude, FFilePlan& Plan)
+	{
+		Plan.NumRows = Tags.Num();
+		if (Settings.Registration == ETagGenRegistration::BulkTable)
+		{
+			const FString DetailNS = DetailNamespace(Settings);
+			if (Tags.Num() == 0)
+			{
+				// A zero sized array is ill-formed
+				Plan.Sections.Add(Text(FString::Printf(BulkSourceEmptyTpl, *HeaderInclude, *Settings.Namespace, *DetailNS)));
+				return;
+			}
+			Plan.Sections.Add(Text(FString::Printf(BulkSourceTpl, *HeaderInclude, *Settings.Namespace, *DetailNS)));
+			Plan.Sections.Add(TagRows(Tags, &FormatTagStrings));
+			Plan.Sections.Add(Text(BulkSourceEpilogue));
+			return;
+		}
+
+		Plan.Sections.Add(Text(FString::Printf(SourceTpl, *HeaderInclude, *Settings.Namespace)));
+		Plan.Sections.Add(TagRows(Tags, &FormatDefinitions));
+		Plan.Sections.Add(Text(Epilogue));
+	}
+
+	/** Row section printing one integer per node, e.g. a parent index. */
+	FSection IntRows(TSharedRef<const TArray<int32>> Values)
+	{
+		return Rows([Values](int32 FirstIndex, int32 NumRows, FString& Out)
+		{
+			Out.Reserve(NumRows * 12);
+			for (int32 Index = FirstIndex; Index < FirstIndex + NumRows; ++Index)
+			{
+				Out.Append(TEXT("\t\t\t"));
+				Out.AppendInt((*Values)[Index]);
+				Out.Append(TEXT(",\n"));
+			}
+		});
+	}
+
+	/** Prefix of the hierarchy node enumerators; keeps them apart from NumNodes and valid for digit-leading segments. */
+	static constexpr TCHAR NodeEnumPrefix[] = TEXT("TAG_");
+
+	/** Same for row enumerators and NumRows; row names are not even restricted to tag syntax. */
+	static constexpr TCHAR RowEnumPrefix[] = TEXT("ROW_");
+
+	FString EnumIdentifier(const TCHAR* Prefix, FName Name)
+	{
+		return Prefix + SanitizeIdentifier(Name.ToString());
+	}
+
+	/** Identifiers are compared as the compiler does, case-sensitively. */
+	struct FIdentifierKeyFuncs : BaseKeyFuncs<TPair<FString, FName>, FString, /*bInAllowDuplicateKeys*/false>
+	{
+		static const FString& GetSetKey(const TPair<FString, FName>& Element) { return Element.Key; }
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	/** Logs every pair of names that would become the same enumerator, e.g. A.B and A_B; false if there is any. */
+	bool CheckEnumIdentifiers(TConstArrayView<FName> Names, const TCHAR* Prefix, const FString& Path)
+	{
+		TMap<FString, FName, FDefaultSetAllocator, FIdentifierKeyFuncs> Seen;
+		Seen.Reserve(Names.Num());
+		bool bOk = true;
+		for (const FName Name : Names)
+		{
+			FString Identifier = EnumIdentifier(Prefix, Name);
+			if (const FName* Other = Seen.Find(Identifier))
+			{
+				UE_LOG(LogTemp, Error, TEXT("%s and %s would both generate %s in %s"), *Other->ToString(), *Name.ToString(), *Identifier, *Path);
+				bOk = false;
+				continue;
+			}
+			Seen.Add(MoveTemp(Identifier), Name);
+		}
+		return bOk;
+	}
+
+	/** Row section of enum entries with explicit values, so generated indices can be checked at a glance. */
+	FSection IndexedEnumRows(TSharedRef<const TArray<FName>> Names, const TCHAR* Prefix)
+	{
+		return Rows([Names, Prefix](int32 FirstIndex, int32 NumRows, FString& Out)
+		{
+			for (int32 Index = FirstIndex; Index < FirstIndex + NumRows; ++Index)
+			{
+				Out.Append(EnumPrefix, Len(EnumPrefix));
+				Out.Append(EnumIdentifier(Prefix, (*Names)[Index]));
+				Out.Append(TEXT(" = "));
+				Out.AppendInt(Index);
+				Out.Append(EnumSuffix, Len(EnumSuffix));
+			}
+		});
+	}
+
+	/**
+	 * Plans the standalone hierarchy header: every tag plus its implicit parents numbered in pre-order, with
+	 * parent and subtree-end arrays so ancestry becomes an integer range check usable from any thread. Without
+	 * tags only the enum is written.
+	 */
+	void PlanHierarchy(TConstArrayView<FName> Tags, const FTagGenSettings& Settings, FFilePlan& Plan)
+	{
+		const TSharedRef<FGameplayTagHierarchy> Hierarchy = MakeShared<FGameplayTagHierarchy>();
+		FGameplayTagCodeGenerator::BuildHierarchy(Tags, *Hierarchy);
+		const TSharedRef<const TArray<int32>> Parents(Hierarchy, &Hierarchy->Parents);
+		const TSharedRef<const TArray<int32>> SubtreeEnds(Hierarchy, &Hierarchy->SubtreeEnds);
+
+		Plan.NumRows = Hierarchy->Nodes.Num();
+		Plan.Sections.Add(Text(FString::Printf(TEXT(
+			"%s#pragma once\n\n#include \"CoreMinimal.h\"\n\nnamespace %s\n{\n"
+			"\tnamespace %s_Hierarchy\n\t{\n"
+			"\t\t/** Every generated tag and implicit parent, numbered in pre-order. */\n"
+			"\t\tenum ENode : int32\n\t\t{\n"),
+			FGameplayTagCodeGenerator::GeneratedMarker, *Settings.Namespace, *SanitizeIdentifier(Settings.FileStem))));
+		Plan.Sections.Add(IndexedEnumRows(TSharedRef<const TArray<FName>>(Hierarchy, &Hierarchy->Nodes), NodeEnumPrefix));
+		if (Hierarchy->Nodes.IsEmpty())
+		{
+			// A zero sized array is ill-formed, and there is no node to ask about
+			Plan.Sections.Add(Text(TEXT("\t\t\tNumNodes\n\t\t};\n\t}\n}\n")));
+			return;
+		}
+		Plan.Sections.Add(Text(TEXT(
+			"\t\t\tNumNodes\n\t\t};\n\n"
+			"\t\t/** Parent of each node, INDEX_NONE for roots. */\n"
+			"\t\tinline constexpr int32 ParentIndex[] =\n\t\t{\n")));
+		Plan.Sections.Add(IntRows(Parents));
+		Plan.Sections.Add(Text(TEXT(
+			"\t\t};\n\n"
+			"\t\t/** One past the last node of each node's subtree. */\n"
+			"\t\tinline constexpr int32 SubtreeEnd[] =\n\t\t{\n")));
+		Plan.Sections.Add(IntRows(SubtreeEnds));
+		Plan.Sections.Add(Text(TEXT(
+			"\t\t};\n\n"
+			"\t\t/** Same as FGameplayTag::MatchesTag: true if Node is Ancestor or below it. */\n"
+			"\t\tconstexpr bool IsChildOf(int32 Node, int32 Ancestor) { return Node >= Ancestor && Node < SubtreeEnd[Ancestor]; }\n\n"
+			"\t\t/** True if Node is strictly below Ancestor. */\n"
+			"\t\tconstexpr bool IsStrictChildOf(int32 Node, int32 Ancestor) { return Node > Ancestor && Node < SubtreeEnd[Ancestor]; }\n"
+			"\t}\n}\n")));
+	}
+
+	/**
+	 * Plans the row index header of a tag-keyed table: one constant per row in row map order, the checksum of
+	 * the row names and a binding that validates both against the table whenever its index is built.
+	 */
+	void PlanRowIndex(TConstArrayView<FName> RowNames, const FTagGenSettings& Settings, FFilePlan& Plan)
+	{
+		const TSharedRef<const TArray<FName>> Names = MakeShared<const TArray<FName>>(RowNames);
+
+		Plan.NumRows = RowNames.Num();
+		Plan.Sections.Add(Text(FString::Printf(TEXT(
+			"%s#pragma once\n\n#include \"CoreMinimal.h\"\n#include \"DataTableTagIndex.h\"\n\n"
+			"// Row indices of %s. Requires a dependency on the DataTableGameplayTag module.\n"
+			"namespace %s\n{\n"
+			"\tnamespace %s_Rows\n\t{\n"
+			"\t\tinline constexpr const TCHAR* TablePath = TEXT(\"%s\");\n"
+			"\t\tinline constexpr uint32 Checksum = 0x%08xu;\n\n"
+			"\t\tenum ERow : int32\n\t\t{\n"),
+			FGameplayTagCodeGenerator::GeneratedMarker, *Settings.TablePath, *Settings.Namespace, *SanitizeIdentifier(Settings.FileStem),
+			*Settings.TablePath, FDataTableTagIndex::ComputeChecksum(RowNames))));
+		Plan.Sections.Add(IndexedEnumRows(Names, RowEnumPrefix));
+		Plan.Sections.Add(Text(TEXT(
+			"\t\t\tNumRows\n\t\t};\n\n"
+			"\t\t/** Reports stale indices when the table's index is built after load or after a change. */\n"
+			"\t\tinline const FDataTableTagIndexBinding Binding(TablePath, Checksum, NumRows);\n\n"
+			"\t\t/** Row at a generated index, or null if the table changed since generation or is not of type T. */\n"
+			"\t\ttemplate <typename T>\n"
+			"\t\tconst T* Find(const UDataTable& Table, ERow Row)\n\t\t{\n"
+			"\t\t\treturn reinterpret_cast<const T*>(FDataTableTagIndex::FindRowByIndex(Table, Row, Checksum, T::StaticStruct()));\n"
+			"\t\t}\n"
+			"\t}\n}\n")));
+	}
+
+	bool IsUnsigned(const FNumericProperty* Property)
+	{
+		return Property->IsA<FByteProperty>() || Property->IsA<FUInt16Property>() || Property->IsA<FUInt32Property>() || Property->IsA<FUInt64Property>();
+	}
+
+	/** C++ type of a field that can be baked into a constexpr initializer, or empty. Enums bake their underlying integer. */
+	FString PodType(const FProperty* Property)
+	{
+		if (Property->ArrayDim != 1)
+		{
+			return FString();
+		}
+		if (Property->IsA<FBoolProperty>())
+		{
+			return TEXT("bool");
+		}
+		if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+		{
+			return PodType(EnumProperty->GetUnderlyingProperty());
+		}
+		if (Property->IsA<FByteProperty>())
+		{
+			// Also byte enums, whose C++ type would be the enum
+			return TEXT("uint8");
+		}
+		if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+		{
+			return NumericProperty->GetCPPType();
+		}
+		return FString();
+	}
+
+	/** Appends a literal of a field accepted by PodType; false for values without one, such as NaN. */
+	bool AppendPodValue(FString& Out, const FProperty* Property, const void* Value)
+	{
+		if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+		{
+			Out.Append(BoolProperty->GetPropertyValue(Value) ? TEXT("true") : TEXT("false"));
+			return true;
+		}
+		if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+		{
+			return AppendPodValue(Out, EnumProperty->GetUnderlyingProperty(), Value);
+		}
+
+		const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+		if (NumericProperty->IsFloatingPoint())
+		{
+			const double Number = NumericProperty->GetFloatingPointPropertyValue(Value);
+			if (!FMath::IsFinite(Number))
+			{
+				return false;
+			}
+
+			// Enough digits to read back the exact same value
+			const bool bFloat = Property->IsA<FFloatProperty>();
+			FString Literal = FString::Printf(bFloat ? TEXT("%.9g") : TEXT("%.17g"), Number);
+			if (!Literal.Contains(TEXT(".")) && !Literal.Contains(TEXT("e")))
+			{
+				Literal.Append(TEXT(".0"));
+			}
+			Out.Append(Literal);
+			if (bFloat)
+			{
+				Out.AppendChar(TEXT('f'));
+			}
+			return true;
+		}
+
+		const bool b64 = Property->IsA<FInt64Property>() || Property->IsA<FUInt64Property>();
+		if (IsUnsigned(NumericProperty))
+		{
+			Out.Appendf(TEXT("%llu%s"), NumericProperty->GetUnsignedIntPropertyValue(Value), b64 ? TEXT("ull") : TEXT("u"));
+			return true;
+		}
+
+		const int64 Number = NumericProperty->GetSignedIntPropertyValue(Value);
+		if (Number == MIN_int64)
+		{
+			// Its magnitude does not fit a literal
+			Out.Append(TEXT("MIN_int64"));
+		}
+		else
+		{
+			Out.Appendf(TEXT("%lld%s"), Number, b64 ? TEXT("ll") : TEXT(""));
+		}
+		return true;
+	}
+
+	/**
+	 * Plans the row data header of a tag-keyed table: a POD mirror of the row struct, a constexpr array with every
+	 * row, one constant per row indexing into it, and a binding that warns when the asset no longer matches.
+	 */
+	void PlanRowData(const FTagGenSettings& Settings, FFilePlan& Plan)
+	{
+		const TSharedRef<const FTagGenRowData> Data = Settings.RowData.ToSharedRef();
+		const TSharedRef<const TArray<FName>> Names(Data, &Data->RowNames);
+
+		FString Fields;
+		for (int32 Field = 0; Field < Data->FieldNames.Num(); ++Field)
+		{
+			Fields.Appendf(TEXT("\t\t\t%s %s;\n"), *Data->FieldTypes[Field], *Data->FieldNames[Field]);
+		}
+
+		Plan.NumRows = Data->RowNames.Num();
+		Plan.Sections.Add(Text(FString::Printf(TEXT(
+			"%s#pragma once\n\n#include \"CoreMinimal.h\"\n#include \"DataTableTagRowData.h\"\n\n"
+			"// Rows of %s baked into constexpr data. Requires a dependency on the DataTableGameplayTag module.\n"
+			"namespace %s\n{\n"
+			"\tnamespace %s_Data\n\t{\n"
+			"\t\tinline constexpr const TCHAR* TablePath = TEXT(\"%s\");\n"
+			"\t\tinline constexpr uint32 Checksum = 0x%08xu;\n\n"
+			"\t\tstruct FRow\n\t\t{\n%s\t\t};\n\n"
+			"\t\tenum ERow : int32\n\t\t{\n"),
+			FGameplayTagCodeGenerator::GeneratedMarker, *Settings.TablePath, *Settings.Namespace, *SanitizeIdentifier(Settings.FileStem),
+			*Settings.TablePath, Data->Checksum, *Fields)));
+		Plan.Sections.Add(IndexedEnumRows(Names, RowEnumPrefix));
+		Plan.Sections.Add(Text(TEXT(
+			"\t\t\tNumRows\n\t\t};\n\n"
+			"\t\tinline constexpr FRow Rows[] =\n\t\t{\n")));
+		Plan.Sections.Add(Rows([Data](int32 FirstIndex, int32 NumRows, FString& Out)
+		{
+			for (int32 Index = FirstIndex; Index < FirstIndex + NumRows; ++Index)
+			{
+				Out.Append(TEXT("\t\t\t"));
+				Out.Append(Data->Initializers[Index]);
+				Out.Append(TEXT(", // "));
+				Data->RowNames[Index].AppendString(Out);
+				Out.AppendChar(TEXT('\n'));
+			}
+		}));
+		Plan.Sections.Add(Text(TEXT(
+			"\t\t};\n"
+			"\t\tstatic_assert(UE_ARRAY_COUNT(Rows) == NumRows, \"Generated row data is out of sync with its row constants\");\n\n"
+			"\t\t/** Warns at startup and whenever the table is indexed if the asset no longer matches the rows baked here. */\n"
+			"\t\tinline const FDataTableTagRowDataBinding Binding(TablePath, Checksum, NumRows);\n\n"
+			"\t\tconstexpr const FRow& Get(ERow Row) { return Rows[Row]; }\n"
+			"\t}\n}\n")));
+	}
+
+	/** Second line of every umbrella header, whose includes then name exactly the shards of its run. */
+	static constexpr TCHAR UmbrellaComment[] = TEXT("// Includes every shard; prefer including only the shard you need.\n");
+
+	/** File stems of the shards included by a previously generated umbrella header. */
+	void ReadUmbrellaShards(const FString& HeaderPath, const FString& FileStem, TArray<FString>& OutStems)
+	{
+		FString Content;
+		if (!FFileHelper::LoadFileToString(Content, *HeaderPath) || !Content.Contains(UmbrellaComment, ESearchCase::CaseSensitive))
+		{
+			return;
+		}
+
+		static constexpr TCHAR IncludePrefix[] = TEXT("#include \"");
+		TArray<FString> Lines;
+		Content.ParseIntoArrayLines(Lines);
+		for (const FString& Line : Lines)
+		{
+			if (!Line.StartsWith(IncludePrefix, ESearchCase::CaseSensitive) || !Line.EndsWith(TEXT("\""), ESearchCase::CaseSensitive))
+			{
+				continue;
+			}
+			const FString Stem = FPaths::GetBaseFilename(Line.Mid(Len(IncludePrefix), Line.Len() - Len(IncludePrefix) - 1));
+			if (Stem.StartsWith(FileStem + TEXT("_"), ESearchCase::CaseSensitive))
+			{
+				OutStems.Add(Stem);
+			}
+		}
+	}
+
+	/** True if the file's UTF-8 content begins with Prefix; only the prefix is read. */
+	bool FileStartsWith(const FString& Path, const FString& Prefix)
+	{
+		const FTCHARToUTF8 Expected(*Prefix);
+		TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Path));
+		if (!Reader || Reader->TotalSize() < Expected.Length())
+		{
+			return false;
+		}
+
+		TArray<ANSICHAR> Head;
+		Head.SetNumUninitialized(Expected.Length());
+		Reader->Serialize(Head.GetData(), Head.Num());
+		return FMemory::Memcmp(Head.GetData(), Expected.Get(), Expected.Length()) == 0;
+	}
+
+	bool IsGeneratedFile(const FString& Path)
+	{
+		return FileStartsWith(Path, FGameplayTagCodeGenerator::GeneratedMarker);
+	}
+
+	/** The original Printf based formatter, kept as the benchmark baseline. */
+	FString FormatHeaderReference(TConstArrayView<FName> Tags, const FString& NS)
+	{
+		FString Out = FString::Printf(HeaderTpl, *NS);
+		for (const FName Tag : Tags)
+		{
+			FString Name = Tag.ToString();
+			Name.ReplaceInline(TEXT("."), TEXT("_"));
+			Out += FString::Printf(TEXT("\tUE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_%s);\n"), *Name);
+		}
+		Out.Append(Epilogue);
+		return Out;
+	}
+
+	FString FormatSourceReference(TConstArrayView<FName> Tags, const FString& NS, const FString& HeaderInclude)
+	{
+		FString Out = FString::Printf(SourceTpl, *HeaderInclude, *NS);
+		for (const FName Tag : Tags)
+		{
+			FString Name = Tag.ToString();
+			Name.ReplaceInline(TEXT("."), TEXT("_"));
+			Out += FString::Printf(TEXT("\tUE_DEFINE_GAMEPLAY_TAG(TAG_%s, \"%s\");\n"), *Name, *Tag.ToString());
+		}
+		Out.Append(Epilogue);
+		return Out;
+	}
+
+	void RunBenchmark(const TArray<FString>& Args)
+	{
+		const int32 NumRows = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 100000;
+		if (NumRows <= 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("TagGen.Benchmark: invalid row count"));
+			return;
+		}
+
+		TArray<FName> Tags;
+		Tags.Reserve(NumRows);
+		for (int32 Index = 0; Index < NumRows; ++Index)
+		{
+			Tags.Emplace(*FString::Printf(TEXT("Bench.Category%d.Group%d.Tag%d"), Index / 1000, (Index / 100) % 10, Index % 100));
+		}
+
+		FTagGenSettings Settings;
+		Settings.Namespace = TEXT("BenchTags");
+		Settings.FileStem = TEXT("BenchTags");
+		const FString Dir = FPaths::ProjectIntermediateDir() / TEXT("TagGenBenchmark");
+		const FString Include = FGameplayTagCodeGenerator::ComputeHeaderInclude(FString(), Settings.FileStem);
+
+		double Start = FPlatformTime::Seconds();
+		const FString RefHeader = FormatHeaderReference(Tags, Settings.Namespace);
+		const FString RefSource = FormatSourceReference(Tags, Settings.Namespace, Include);
+		const double ReferenceTime = FPlatformTime::Seconds() - Start;
+
+		FGeneratedTagFile Header, Source;
+		Start = FPlatformTime::Seconds();
+		FGameplayTagCodeGenerator::BuildFiles(Tags, Settings, Include, Header, Source);
+		const double BuildTime = FPlatformTime::Seconds() - Start;
+
+		Header.Path = Dir / TEXT("BenchTags.h");
+		Source.Path = Dir / TEXT("BenchTags.cpp");
+		Start = FPlatformTime::Seconds();
+		const bool bWritten = FGameplayTagCodeGenerator::WriteFile(Header) && FGameplayTagCodeGenerator::WriteFile(Source);
+		const double WriteTime = FPlatformTime::Seconds() - Start;
+
+		const bool bIdentical = Header.ToString() == RefHeader && Source.ToString() == RefSource;
+
+		UE_LOG(LogTemp, Display, TEXT("TagGen.Benchmark: %d rows, reference format %.2f ms, chunked format %.2f ms, stream to disk %.2f ms%s%s"),
+			NumRows, ReferenceTime * 1000.0, BuildTime * 1000.0, WriteTime * 1000.0,
+			bIdentical ? TEXT("") : TEXT(" [OUTPUT MISMATCH]"),
+			bWritten ? TEXT("") : TEXT(" [WRITE FAILED]"));
+	}
+
+	static FAutoConsoleCommand BenchmarkCommand(
+		TEXT("TagGen.Benchmark"),
+		TEXT("Generates native gameplay tag files from a synthetic table and reports timings. Usage: TagGen.Benchmark [NumRows=100000]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunBenchmark));
+}
+
+const TCHAR* FGameplayTagCodeGenerator::HierarchySuffix = TEXT("Hierarchy");
+const TCHAR* FGameplayTagCodeGenerator::RowIndexSuffix = TEXT("Rows");
+const TCHAR* FGameplayTagCodeGenerator::RowDataSuffix = TEXT("Data");
+const TCHAR* FGameplayTagCodeGenerator::GeneratedMarker = TEXT("// Generated by DataTableGameplayTag. Do not edit.\n");
+
+FString FGeneratedTagFile::ToString() const
+{
+	int32 Size = 0;
+	for (const FString& Chunk : Chunks)
+	{
+		Size += Chunk.Len();
+	}
+
+	FString Out;
+	Out.Reserve(Size);
+	for (const FString& Chunk : Chunks)
+	{
+		Out.Append(Chunk);
+	}
+	return Out;
+}
+
+void FGameplayTagCodeGenerator::AppendIdentifier(FString& Out, FName Tag)
+{
+	const int32 Start = Out.Len();
+	Tag.AppendString(Out);
+
+	TCHAR* Data = Out.GetCharArray().GetData();
+	for (int32 Index = Start; Index < Out.Len(); ++Index)
+	{
+		if (Data[Index] == TEXT('.'))
+		{
+			Data[Index] = TEXT('_');
+		}
+	}
+}
+
+void FGameplayTagCodeGenerator::BuildHierarchy(TConstArrayView<FName> Tags, FGameplayTagHierarchy& OutHierarchy)
+{
+	OutHierarchy = FGameplayTagHierarchy();
+
+	// FName comparison is case-insensitive, like gameplay tags
+	TSet<FName> NodeSet;
+	for (const FName Tag : Tags)
+	{
+		const FString TagString = Tag.ToString();
+		for (int32 Dot = TagString.Find(TEXT(".")); Dot != INDEX_NONE; Dot = TagString.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromStart, Dot + 1))
+		{
+			NodeSet.Add(FName(Dot, *TagString));
+		}
+		NodeSet.Add(Tag);
+	}
+
+	// With '.' ordered before any other character, a sorted list of paths is a pre-order walk of the tree
+	TArray<FString> Paths;
+	Paths.Reserve(NodeSet.Num());
+	for (const FName Node : NodeSet)
+	{
+		Paths.Add(Node.ToString());
+	}
+	Paths.Sort([](const FString& A, const FString& B)
+	{
+		const int32 Num = FMath::Min(A.Len(), B.Len());
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			const TCHAR CharA = A[Index] == TEXT('.') ? TEXT('\0') : FChar::ToLower(A[Index]);
+			const TCHAR CharB = B[Index] == TEXT('.') ? TEXT('\0') : FChar::ToLower(B[Index]);
+			if (CharA != CharB)
+			{
+				return CharA < CharB;
+			}
+		}
+		return A.Len() < B.Len();
+	});
+
+	TMap<FName, int32> NodeIndices;
+	NodeIndices.Reserve(Paths.Num());
+	OutHierarchy.Nodes.Reserve(Paths.Num());
+	OutHierarchy.Parents.Reserve(Paths.Num());
+	OutHierarchy.SubtreeEnds.Reserve(Paths.Num());
+	for (const FString& Path : Paths)
+	{
+		const FName Node(*Path);
+		int32 Dot = INDEX_NONE;
+		Path.FindLastChar(TEXT('.'), Dot);
+
+		// Parents sort before their children so they are always indexed already
+		NodeIndices.Add(Node, OutHierarchy.Nodes.Num());
+		OutHierarchy.Parents.Add(Dot == INDEX_NONE ? INDEX_NONE : NodeIndices.FindChecked(FName(Dot, *Path)));
+		OutHierarchy.SubtreeEnds.Add(OutHierarchy.Nodes.Num() + 1);
+		OutHierarchy.Nodes.Add(Node);
+	}
+
+	// Children come after their parent, so a reverse pass sees every subtree complete before its parent
+	for (int32 Index = OutHierarchy.Nodes.Num() - 1; Index >= 0; --Index)
+	{
+		const int32 Parent = OutHierarchy.Parents[Index];
+		if (Parent != INDEX_NONE)
+		{
+			OutHierarchy.SubtreeEnds[Parent] = FMath::Max(OutHierarchy.SubtreeEnds[Parent], OutHierarchy.SubtreeEnds[Index]);
+		}
+	}
+}
+
+FString FGameplayTagCodeGenerator::ComputeCompanionPath(const FTagGenSettings& Settings, const TCHAR* Suffix)
+{
+	FString HeaderPath, SourcePath;
+	ComputeOutputPaths(Settings.ModuleSourcePath, Settings.RelPath, Settings.FileStem + Suffix, HeaderPath, SourcePath);
+	return HeaderPath;
+}
+
+void FGameplayTagCodeGenerator::BuildRowIndex(TConstArrayView<FName> RowNames, const FTagGenSettings& Settings, FGeneratedTagFile& OutFile)
+{
+	OutFile.Path = ComputeCompanionPath(Settings, RowIndexSuffix);
+
+	TagCodeGen::FFilePlan Plan;
+	Plan.File = &OutFile;
+	TagCodeGen::PlanRowIndex(RowNames, Settings, Plan);
+	TagCodeGen::Assemble(MakeArrayView(&Plan, 1));
+}
+
+bool FGameplayTagCodeGenerator::GatherRowData(const UDataTable& Table, FTagGenRowData& OutRowData)
+{
+	OutRowData = FTagGenRowData();
+
+	const UScriptStruct* RowStruct = Table.GetRowStruct();
+	if (!RowStruct || Table.GetRowMap().Num() == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s has no rows to bake"), *Table.GetPathName());
+		return false;
+	}
+
+	const FStructProperty* MaskProperty = FDataTableTagInheritance::FindMaskProperty(*RowStruct);
+	TArray<const FProperty*> Fields;
+	for (TFieldIterator<FProperty> It(RowStruct); It; ++It)
+	{
+		if (*It == MaskProperty)
+		{
+			continue;
+		}
+
+		const FString Type = TagCodeGen::PodType(*It);
+		if (Type.IsEmpty())
+		{
+			UE_LOG(LogTemp, Error, TEXT("Cannot bake the rows of %s: field %s of %s is not a bool, number or enum"),
+				*Table.GetPathName(), *It->GetAuthoredName(), *RowStruct->GetName());
+			return false;
+		}
+		Fields.Add(*It);
+		OutRowData.FieldTypes.Add(Type);
+		OutRowData.FieldNames.Add(TagCodeGen::SanitizeIdentifier(It->GetAuthoredName()));
+	}
+
+	// Built without the cooked hash, so any thread can gather; inheriting tables come back flattened
+	const FDataTableTagIndex Index(Table, nullptr);
+	OutRowData.RowNames.Reserve(Index.Num());
+	OutRowData.Initializers.Reserve(Index.Num());
+	for (int32 Row = 0; Row < Index.Num(); ++Row)
+	{
+		FString& Initializer = OutRowData.Initializers.AddDefaulted_GetRef();
+		Initializer.Append(TEXT("{ "));
+		for (int32 Field = 0; Field < Fields.Num(); ++Field)
+		{
+			if (Field > 0)
+			{
+				Initializer.Append(TEXT(", "));
+			}
+			if (!TagCodeGen::AppendPodValue(Initializer, Fields[Field], Fields[Field]->ContainerPtrToValuePtr<void>(Index.GetRow(Row))))
+			{
+				UE_LOG(LogTemp, Error, TEXT("Cannot bake the rows of %s: field %s of row %s is not a finite number"),
+					*Table.GetPathName(), *Fields[Field]->GetAuthoredName(), *Index.GetRowName(Row).ToString());
+				return false;
+			}
+		}
+		Initializer.Append(TEXT(" }"));
+		OutRowData.RowNames.Add(Index.GetRowName(Row));
+	}
+	OutRowData.Checksum = FDataTableTagRowDataBinding::ComputeChecksum(Index);
+	return true;
+}
+
+void FGameplayTagCodeGenerator::BuildRowData(const FTagGenSettings& Settings, FGeneratedTagFile& OutFile)
+{
+	OutFile.Path = ComputeCompanionPath(Settings, RowDataSuffix);
+
+	TagCodeGen::FFilePlan Plan;
+	Plan.File = &OutFile;
+	TagCodeGen::PlanRowData(Settings, Plan);
+	TagCodeGen::Assemble(MakeArrayView(&Plan, 1));
+}
+
+void FGameplayTagCodeGenerator::GatherRowNames(const UDataTable& Table, TArray<FName>& OutRowNames)
+{
+	OutRowNames.Reset();
+	Table.GetRowMap().GenerateKeyArray(OutRowNames);
+}
+
+void FGameplayTagCodeGenerator::GatherTags(const UDataTable& Table, TArray<FName>& OutTags, int32 MaxTags)
+{
+	OutTags.Reset();
+
+	const UScriptStruct* RowStruct = Table.GetRowStruct();
+	if (!RowStruct)
+	{
+		return;
+	}
+
+	// Tag tables carry the tag in the row, any other table is keyed by tag
+	const bool bTagTable = RowStruct->IsChildOf(FGameplayTagTableRow::StaticStruct());
+	const TMap<FName, uint8*>& RowMap = Table.GetRowMap();
+	OutTags.Reserve(FMath::Min(MaxTags, RowMap.Num()));
+	for (const TPair<FName, uint8*>& Pair : RowMap)
+	{
+		if (OutTags.Num() >= MaxTags)
+		{
+			break;
+		}
+		OutTags.Add(bTagTable ? reinterpret_cast<const FGameplayTagTableRow*>(Pair.Value)->Tag : Pair.Key);
+	}
+}
+
+void FGameplayTagCodeGenerator::BuildHeader(TConstArrayView<FName> Tags, const FTagGenSettings& Settings, FGeneratedTagFile& OutHeader)
+{
+	TagCodeGen::FFilePlan Plan;
+	Plan.File = &OutHeader;
+	TagCodeGen::PlanHeader(Tags, Settings, Plan);
+	TagCodeGen::Assemble(MakeArrayView(&Plan, 1));
+}
+
+void FGameplayTagCodeGenerator::BuildSource(TConstArrayView<FName> Tags, const FTagGenSettings& Settings, const FString& HeaderInclude, FGeneratedTagFile& OutSource)
+{
+	TagCodeGen::FFilePlan Plan;
+	Plan.File = &OutSource;
+	TagCodeGen::PlanSource(Tags, Settings, HeaderInclude, Plan);
+	TagCodeGen::Assemble(MakeArrayView(&Plan, 1));
+}
+
+void FGameplayTagCodeGenerator::BuildFiles(TConstArrayView<FName> Tags, const FTagGenSettings& Settings, const FString& HeaderInclude, FGeneratedTagFile& OutHeader, FGeneratedTagFile& OutSource)
+{
+	TagCodeGen::FFilePlan Plans[2];
+	Plans[0].File = &OutHeader;
+	Plans[1].File = &OutSource;
+	TagCodeGen::PlanHeader(Tags, Settings, Plans[0]);
+	TagCodeGen::PlanSource(Tags, Settings, HeaderInclude, Plans[1]);
+	TagCodeGen::Assemble(MakeArrayView(Plans));
+}
+
+bool FGameplayTagCodeGenerator::WriteFile(const FGeneratedTagFile& File)
+{
+	IFileManager& FM = IFileManager::Get();
+	const FString Dir = FPaths::GetPath(File.Path);
+	if (!FM.MakeDirectory(*Dir, /*Tree*/true))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Cannot create directory %s"), *Dir);
+		return false;
+	}
+
+	TUniquePtr<FArchive> Writer(FM.CreateFileWriter(*File.Path));
+	if (!Writer)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Cannot open %s for writing"), *File.Path);
+		return false;
+	}
+
+	for (const FString& Chunk : File.Chunks)
+	{
+		FTCHARToUTF8 Utf8(*Chunk, Chunk.Len());
+		Writer->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+	}
+	return Writer->Close();
+}
+
+bool FGameplayTagCodeGenerator::MatchesFileOnDisk(const FGeneratedTagFile& File)
+{
+	int64 Size = 0;
+	FXxHash64Builder Generated;
+	for (const FString& Chunk : File.Chunks)
+	{
+		FTCHARToUTF8 Utf8(*Chunk, Chunk.Len());
+		Generated.Update(Utf8.Get(), Utf8.Length());
+		Size += Utf8.Length();
+	}
+
+	// A size mismatch (or a missing file) settles it without reading anything.
+	IFileManager& FM = IFileManager::Get();
+	if (FM.FileSize(*File.Path) != Size)
+	{
+		return false;
+	}
+
+	TUniquePtr<FArchive> Reader(FM.CreateFileReader(*File.Path));
+	if (!Reader)
+	{
+		return false;
+	}
+
+	FXxHash64Builder OnDisk;
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(64 * 1024);
+	for (int64 Remaining = Size; Remaining > 0;)
+	{
+		const int64 Count = FMath::Min<int64>(Remaining, Buffer.Num());
+		Reader->Serialize(Buffer.GetData(), Count);
+		OnDisk.Update(Buffer.GetData(), Count);
+		Remaining -= Count;
+	}
+	return !Reader->IsError() && OnDisk.Finalize() == Generated.Finalize();
+}
+
+bool FGameplayTagCodeGenerator::WriteFileIfChanged(const FGeneratedTagFile& File, bool& bOutWritten)
+{
+	bOutWritten = false;
+	if (MatchesFileOnDisk(File))
+	{
+		return true;
+	}
+
+	bOutWritten = WriteFile(File);
+	return bOutWritten;
+}
+
+void FGameplayTagCodeGenerator::ReadGeneratedTags(const FString& SourcePath, TArray<FName>& OutTags)
+{
+	FString Content;
+	if (!FFileHelper::LoadFileToString(Content, *SourcePath))
+	{
+		return;
+	}
+
+	// Per-tag objects quote the tag in UE_DEFINE_GAMEPLAY_TAG, bulk tables list it as TEXT("...")
+	const TCHAR* DefineMarker = Content.Contains(TEXT("FNativeGameplayTagTable"), ESearchCase::CaseSensitive) ? TEXT("TEXT(") : TEXT("UE_DEFINE_GAMEPLAY_TAG(");
+	for (int32 Pos = Content.Find(DefineMarker, ESearchCase::CaseSensitive); Pos != INDEX_NONE;
+		 Pos = Content.Find(DefineMarker, ESearchCase::CaseSensitive, ESearchDir::FromStart, Pos + 1))
+	{
+		const int32 Open = Content.Find(TEXT("\""), ESearchCase::CaseSensitive, ESearchDir::FromStart, Pos);
+		const int32 Close = Open != INDEX_NONE ? Content.Find(TEXT("\""), ESearchCase::CaseSensitive, ESearchDir::FromStart, Open + 1) : INDEX_NONE;
+		if (Close == INDEX_NONE)
+		{
+			break;
+		}
+		OutTags.Emplace(Close - Open - 1, *Content + Open + 1);
+	}
+}
+
+void FGameplayTagCodeGenerator::SplitShards(TConstArrayView<FName> Tags, ETagGenSharding Sharding, int32 TagsPerShard, TArray<FTagGenShard>& OutShards)
+{
+	OutShards.Reset();
+
+	if (Sharding == ETagGenSharding::ByCount)
+	{
+		TagsPerShard = FMath::Max(1, TagsPerShard);
+		for (int32 Start = 0; Start < Tags.Num(); Start += TagsPerShard)
+		{
+			FTagGenShard& Shard = OutShards.AddDefaulted_GetRef();
+			Shard.Name = FString::FromInt(OutShards.Num() - 1);
+			Shard.Tags.Append(Tags.Slice(Start, FMath::Min(TagsPerShard, Tags.Num() - Start)));
+		}
+		return;
+	}
+
+	if (Sharding == ETagGenSharding::ByRoot)
+	{
+		TMap<FString, int32> ShardByRoot;
+		for (const FName Tag : Tags)
+		{
+			TStringBuilder<256> TagString;
+			Tag.AppendString(TagString);
+
+			FStringView Root = TagString.ToView();
+			int32 Dot = INDEX_NONE;
+			if (Root.FindChar(TEXT('.'), Dot))
+			{
+				Root = Root.Left(Dot);
+			}
+
+			FString ShardName = TagCodeGen::SanitizeIdentifier(Root);
+			int32& ShardIndex = ShardByRoot.FindOrAdd(ShardName, INDEX_NONE);
+			if (ShardIndex == INDEX_NONE)
+			{
+				ShardIndex = OutShards.Num();
+				OutShards.AddDefaulted_GetRef().Name = MoveTemp(ShardName);
+			}
+			OutShards[ShardIndex].Tags.Add(Tag);
+		}
+
+		OutShards.Sort([](const FTagGenShard& A, const FTagGenShard& B) { return A.Name < B.Name; });
+		return;
+	}
+
+	OutShards.AddDefaulted_GetRef().Tags.Append(Tags);
+}
+
+void FGameplayTagCodeGenerator::BuildOutputs(TConstArrayView<FName> Tags, const FTagGenSettings& Settings, TArray<FGeneratedTagFile>& OutFiles)
+{
+	OutFiles.Reset();
+	BuildTagOutputs(Tags, Settings, OutFiles);
+
+	// Covers the whole table even when sharded, so any two tags can be compared
+	if (Settings.bEmitHierarchy)
+	{
+		FGeneratedTagFile& Hierarchy = OutFiles.AddDefaulted_GetRef();
+		Hierarchy.Path = ComputeCompanionPath(Settings, HierarchySuffix);
+
+		TagCodeGen::FFilePlan Plan;
+		Plan.File = &Hierarchy;
+		TagCodeGen::PlanHierarchy(Tags, Settings, Plan);
+		TagCodeGen::Assemble(MakeArrayView(&Plan, 1));
+	}
+}
+
+void FGameplayTagCodeGenerator::BuildTagOutputs(TConstArrayView<FName> Tags, const FTagGenSettings& Settings, TArray<FGeneratedTagFile>& OutFiles)
+{
+	if (Settings.Sharding == ETagGenSharding::None)
+	{
+		OutFiles.SetNum(2);
+		ComputeOutputPaths(Settings.ModuleSourcePath, Settings.RelPath, Settings.FileStem, OutFiles[0].Path, OutFiles[1].Path);
+		BuildFiles(Tags, Settings, ComputeHeaderInclude(Settings.RelPath, Settings.FileStem), OutFiles[0], OutFiles[1]);
+		OutFiles[0].Chunks[0].InsertAt(0, GeneratedMarker);
+		OutFiles[1].Chunks[0].InsertAt(0, GeneratedMarker);
+		return;
+	}
+
+	TArray<FTagGenShard> Shards;
+	SplitShards(Tags, Settings.Sharding, Settings.TagsPerShard, Shards);
+
+	// Slot 0 is the umbrella header, followed by a header/source pair per shard
+	OutFiles.SetNum(1 + 2 * Shards.Num());
+	FString UnusedSource;
+	ComputeOutputPaths(Settings.ModuleSourcePath, Settings.RelPath, Settings.FileStem, OutFiles[0].Path, UnusedSource);
+
+	FString Umbrella = GeneratedMarker;
+	Umbrella += TEXT("#pragma once\n\n");
+	Umbrella += TagCodeGen::UmbrellaComment;
+	for (const FTagGenShard& Shard : Shards)
+	{
+		Umbrella += FString::Printf(TEXT("#include \"%s\"\n"), *ComputeHeaderInclude(Settings.RelPath, Settings.FileStem + TEXT("_") + Shard.Name));
+	}
+	OutFiles[0].Chunks.Add(MoveTemp(Umbrella));
+
+	ParallelFor(Shards.Num(), [&](int32 ShardIndex)
+	{
+		FTagGenSettings ShardSettings = Settings;
+		ShardSettings.FileStem = Settings.FileStem + TEXT("_") + Shards[ShardIndex].Name;
+		FGeneratedTagFile& Header = OutFiles[1 + 2 * ShardIndex];
+		FGeneratedTagFile& Source = OutFiles[2 + 2 * ShardIndex];
+
+		ComputeOutputPaths(Settings.ModuleSourcePath, Settings.RelPath, ShardSettings.FileStem, Header.Path, Source.Path);
+		BuildFiles(Shards[ShardIndex].Tags, ShardSettings, ComputeHeaderInclude(Settings.RelPath, ShardSettings.FileStem), Header, Source);
+		Header.Chunks[0].InsertAt(0, GeneratedMarker);
+		Source.Chunks[0].InsertAt(0, GeneratedMarker);
+	}, TagCodeGen::ParallelFlags(Shards.Num()));
+}
+
+void FGameplayTagCodeGenerator::FindPreviousOutputs(const FTagGenSettings& Settings, TArray<FString>& OutFiles)
+{
+	OutFiles.Reset();
+
+	FString HeaderPath, SourcePath;
+	ComputeOutputPaths(Settings.ModuleSourcePath, Settings.RelPath, Settings.FileStem, HeaderPath, SourcePath);
+
+	// Sources written before the marker existed are recognized by the prologue every generated source starts with
+	IFileManager& FM = IFileManager::Get();
+	const FString SourcePrologue = FString::Printf(TagCodeGen::SourceTpl, *ComputeHeaderInclude(Settings.RelPath, Settings.FileStem), *Settings.Namespace);
+	if (FM.FileExists(*SourcePath) && (TagCodeGen::IsGeneratedFile(SourcePath) || TagCodeGen::FileStartsWith(SourcePath, SourcePrologue)))
+	{
+		OutFiles.Add(SourcePath);
+	}
+
+	for (const TCHAR* Suffix : { HierarchySuffix, RowIndexSuffix, RowDataSuffix })
+	{
+		const FString CompanionPath = ComputeCompanionPath(Settings, Suffix);
+		if (FM.FileExists(*CompanionPath) && TagCodeGen::IsGeneratedFile(CompanionPath))
+		{
+			OutFiles.Add(CompanionPath);
+		}
+	}
+
+	// Shards come from the previous umbrella header rather than a name pattern, which would also match the
+	// outputs of another table whose stem extends this one; the marker line still protects hand-written files
+	TArray<FString> ShardStems;
+	TagCodeGen::ReadUmbrellaShards(HeaderPath, Settings.FileStem, ShardStems);
+	for (const FString& ShardStem : ShardStems)
+	{
+		FString ShardHeader, ShardSource;
+		ComputeOutputPaths(Settings.ModuleSourcePath, Settings.RelPath, ShardStem, ShardHeader, ShardSource);
+		for (const FString& Path : { ShardHeader, ShardSource })
+		{
+			if (FM.FileExists(*Path) && TagCodeGen::IsGeneratedFile(Path))
+			{
+				OutFiles.Add(Path);
+			}
+		}
+	}
+}
+
+bool FGameplayTagCodeGenerator::Generate(const UDataTable& Table, const FTagGenSettings& Settings, FTagGenResult& OutResult)
+{
+	TArray<FName> Tags;
+	GatherTags(Table, Tags);
+
+	TArray<FName> RowNames;
+	if (Settings.bEmitRowIndex)
+	{
+		GatherRowNames(Table, RowNames);
+	}
+
+	FTagGenSettings TableSettings = Settings;
+	TableSettings.TablePath = Table.GetPathName();
+	if (Settings.bEmitRowData && !Settings.RowData.IsValid())
+	{
+		const TSharedRef<FTagGenRowData> RowData = MakeShared<FTagGenRowData>();
+		if (!GatherRowData(Table, *RowData))
+		{
+			return false;
+		}
+		TableSettings.RowData = RowData;
+	}
+	return Generate(Tags, RowNames, TableSettings, OutResult);
+}
+
+bool FGameplayTagCodeGenerator::Generate(TConstArrayView<FName> Tags, TConstArrayView<FName> RowNames, const FTagGenSettings& Settings, FTagGenResult& OutResult)
+{
+	OutResult = FTagGenResult();
+
+	// Names that collapse to the same enumerator would produce a header that does not compile
+	if (Settings.bEmitHierarchy)
+	{
+		FGameplayTagHierarchy Hierarchy;
+		BuildHierarchy(Tags, Hierarchy);
+		if (!TagCodeGen::CheckEnumIdentifiers(Hierarchy.Nodes, TagCodeGen::NodeEnumPrefix, ComputeCompanionPath(Settings, HierarchySuffix)))
+		{
+			return false;
+		}
+	}
+	if (Settings.bEmitRowIndex && !TagCodeGen::CheckEnumIdentifiers(RowNames, TagCodeGen::RowEnumPrefix, ComputeCompanionPath(Settings, RowIndexSuffix)))
+	{
+		return false;
+	}
+	if (Settings.bEmitRowData && Settings.RowData.IsValid()
+		&& !TagCodeGen::CheckEnumIdentifiers(Settings.RowData->RowNames, TagCodeGen::RowEnumPrefix, ComputeCompanionPath(Settings, RowDataSuffix)))
+	{
+		return false;
+	}
+
+	TArray<FGeneratedTagFile> Files;
+	BuildOutputs(Tags, Settings, Files);
+
+	if (Settings.bEmitRowIndex)
+	{
+		BuildRowIndex(RowNames, Settings, Files.AddDefaulted_GetRef());
+	}
+	if (Settings.bEmitRowData)
+	{
+		if (!Settings.RowData.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("No row data was gathered for %s"), *Settings.TablePath);
+			return false;
+		}
+		BuildRowData(Settings, Files.AddDefaulted_GetRef());
+	}
+
+	// Diff against what was generated last time, before it gets overwritten
+	TArray<FString> PreviousFiles;
+	FindPreviousOutputs(Settings, PreviousFiles);
+
+	TArray<FName> PreviousTags;
+	for (const FString& Path : PreviousFiles)
+	{
+		if (Path.EndsWith(TEXT(".cpp")))
+		{
+			ReadGeneratedTags(Path, PreviousTags);
+		}
+	}
+
+	const TSet<FName> PreviousSet(PreviousTags);
+	const TSet<FName> CurrentSet(Tags);
+	for (const FName Tag : Tags)
+	{
+		if (!PreviousSet.Contains(Tag))
+		{
+			OutResult.AddedTags.Add(Tag);
+		}
+	}
+	for (const FName Tag : PreviousTags)
+	{
+		if (!CurrentSet.Contains(Tag))
+		{
+			OutResult.RemovedTags.Add(Tag);
+		}
+	}
+
+	bool bOk = true;
+	for (const FGeneratedTagFile& File : Files)
+	{
+		bool bWritten = false;
+		if (!WriteFileIfChanged(File, bWritten))
+		{
+			bOk = false;
+			continue;
+		}
+		(bWritten ? OutResult.WrittenFiles : OutResult.UnchangedFiles).Add(File.Path);
+	}
+
+	// Shards whose root disappeared, or outputs of the other sharding mode, would otherwise still be compiled
+	for (const FString& Path : PreviousFiles)
+	{
+		if (!Files.ContainsByPredicate([&Path](const FGeneratedTagFile& File) { return FPaths::IsSamePath(File.Path, Path); }))
+		{
+			if (IFileManager::Get().Delete(*Path))
+			{
+				OutResult.DeletedFiles.Add(Path);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Error, TEXT("Cannot delete stale generated file %s"), *Path);
+				bOk = false;
+			}
+		}
+	}
+	return bOk;
+}
+
+bool FGameplayTagCodeGenerator::MakeSettings(const FNativeTagGenEntry& Entry, FTagGenSettings& OutSettings)
+{
+	if (!FindModuleSourcePath(Entry.Module, OutSettings.ModuleSourcePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Module %s of table %s is not part of the project"), *Entry.Module, *Entry.Table.ToString());
+		return false;
+	}
+	if (Entry.Namespace.IsEmpty() || Entry.FileStem.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Table %s needs a namespace and a file name"), *Entry.Table.ToString());
+		return false;
+	}
+
+	OutSettings.RelPath = Entry.RelPath;
+	OutSettings.Namespace = Entry.Namespace;
+	OutSettings.FileStem = Entry.FileStem;
+	OutSettings.Sharding = Entry.Sharding;
+	OutSettings.TagsPerShard = Entry.TagsPerShard;
+	OutSettings.Registration = Entry.Registration;
+	OutSettings.bEmitHierarchy = Entry.bEmitHierarchy;
+	OutSettings.bEmitRowIndex = Entry.bEmitRowIndex;
+	OutSettings.bEmitRowData = Entry.bEmitRowData;
+	OutSettings.TablePath = Entry.Table.ToSoftObjectPath().ToString();
+	return true;
+}
+
+void FGameplayTagCodeGenerator::LogResult(const FTagGenResult& Result)
+{
+	for (const FName Tag : Result.AddedTags)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Gameplay tag added: %s"), *Tag.ToString());
+	}
+	for (const FName Tag : Result.RemovedTags)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Gameplay tag removed: %s"), *Tag.ToString());
+	}
+	for (const FString& Path : Result.UnchangedFiles)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Unchanged, not rewritten: %s"), *Path);
+	}
+	for (const FString& Path : Result.DeletedFiles)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Stale generated file deleted: %s"), *Path);
+	}
+}
+
+bool FGameplayTagCodeGenerator::FindModuleSourcePath(const FString& ModuleName, FString& OutModuleSourcePath)
+{
+	for (const TArray<FModuleContextInfo>& ModuleList : { GameProjectUtils::GetCurrentProjectModules(), GameProjectUtils::GetCurrentProjectPluginModules() })
+	{
+		for (const FModuleContextInfo& Module : ModuleList)
+		{
+			if (Module.ModuleName == ModuleName)
+			{
+				OutModuleSourcePath = Module.ModuleSourcePath;
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+void FGameplayTagCodeGenerator::ComputeOutputPaths(const FString& ModuleSourcePath, const FString& RelPath, const FString& FileStem, FString& OutHeader, FString& OutSource)
+{
+	FString PublicDir = ModuleSourcePath / TEXT("Public");
+	FString PrivateDir = ModuleSourcePath / TEXT("Private");
+	if (!RelPath.IsEmpty())
+	{
+		PublicDir /= RelPath;
+		PrivateDir /= RelPath;
+	}
+	FPaths::NormalizeDirectoryName(PublicDir);
+	FPaths::NormalizeDirectoryName(PrivateDir);
+	if (!PublicDir.EndsWith(TEXT("/"))) PublicDir.AppendChar('/');
+	if (!PrivateDir.EndsWith(TEXT("/"))) PrivateDir.AppendChar('/');
+
+	OutHeader = PublicDir / (FileStem + TEXT(".h"));
+	OutSource = PrivateDir / (FileStem + TEXT(".cpp"));
+}
+
+FString FGameplayTagCodeGenerator::ComputeHeaderInclude(const FString& RelPath, const FString& FileStem)
+{
+	FString IncludeRel = !RelPath.IsEmpty() ? RelPath / (FileStem + TEXT(".h")) : FileStem + TEXT(".h");
+	IncludeRel.ReplaceInline(TEXT("\\"), TEXT("/"));
+	return IncludeRel;
+}
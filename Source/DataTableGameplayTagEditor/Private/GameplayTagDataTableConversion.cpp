@@ -0,0 +1,121 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagDataTable.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+
+namespace GameplayTagDataTableConversion
+{
+	/** Finds the asset of a package, or creates the package and asset; nullptr if the name holds another type. */
+	template <typename T>
+	static T* FindOrCreateAsset(const FString& PackageName)
+	{
+		FText Reason;
+		if (!FPackageName::IsValidLongPackageName(PackageName, /*bIncludeReadOnlyRoots*/false, &Reason))
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s is not a valid package name: %s"), *PackageName, *Reason.ToString());
+			return nullptr;
+		}
+
+		const FString AssetName = FPackageName::GetLongPackageAssetName(PackageName);
+		UPackage* Package = CreatePackage(*PackageName);
+		Package->FullyLoad();
+
+		// Converting again updates the existing asset, so references to it stay valid
+		if (UObject* Existing = FindObject<UObject>(Package, *AssetName))
+		{
+			T* Asset = Cast<T>(Existing);
+			UE_CLOG(!Asset, LogTemp, Error, TEXT("%s is a %s, not a %s"), *PackageName, *Existing->GetClass()->GetName(), *T::StaticClass()->GetName());
+			return Asset;
+		}
+
+		T* Asset = NewObject<T>(Package, *AssetName, RF_Public | RF_Standalone | RF_Transactional);
+		FAssetRegistryModule::AssetCreated(Asset);
+		return Asset;
+	}
+
+	/** TagGen.ConvertToTagTable <DataTablePath> [PackageName] */
+	static void ConvertToTagTableCommand(const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Usage: TagGen.ConvertToTagTable <DataTablePath> [PackageName]"));
+			return;
+		}
+
+		const UDataTable* Table = LoadObject<UDataTable>(nullptr, *Args[0]);
+		if (!Table)
+		{
+			UE_LOG(LogTemp, Error, TEXT("TagGen.ConvertToTagTable: cannot load %s"), *Args[0]);
+			return;
+		}
+
+		const FString PackageName = Args.Num() > 1 ? Args[1] : Table->GetOutermost()->GetName() + TEXT("_TagTable");
+		UGameplayTagDataTable* TagTable = FindOrCreateAsset<UGameplayTagDataTable>(PackageName);
+		if (!TagTable)
+		{
+			return;
+		}
+
+		TArray<FName> Skipped;
+		if (!TagTable->CopyFromDataTable(*Table, &Skipped))
+		{
+			return;
+		}
+		TagTable->MarkPackageDirty();
+
+		for (const FName RowName : Skipped)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("TagGen.ConvertToTagTable: row %s is not a registered tag and was skipped"), *RowName.ToString());
+		}
+		UE_LOG(LogTemp, Display, TEXT("TagGen.ConvertToTagTable: %d rows of %s copied to %s, %d skipped"),
+			TagTable->Num(), *Table->GetName(), *TagTable->GetPathName(), Skipped.Num());
+	}
+
+	/** TagGen.ConvertToDataTable <TagTablePath> [PackageName] */
+	static void ConvertToDataTableCommand(const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Usage: TagGen.ConvertToDataTable <TagTablePath> [PackageName]"));
+			return;
+		}
+
+		const UGameplayTagDataTable* TagTable = LoadObject<UGameplayTagDataTable>(nullptr, *Args[0]);
+		if (!TagTable)
+		{
+			UE_LOG(LogTemp, Error, TEXT("TagGen.ConvertToDataTable: cannot load %s"), *Args[0]);
+			return;
+		}
+		if (!TagTable->GetRowStruct())
+		{
+			UE_LOG(LogTemp, Error, TEXT("TagGen.ConvertToDataTable: %s has no row struct"), *Args[0]);
+			return;
+		}
+
+		const FString PackageName = Args.Num() > 1 ? Args[1] : TagTable->GetOutermost()->GetName() + TEXT("_DataTable");
+		UDataTable* Table = FindOrCreateAsset<UDataTable>(PackageName);
+		if (!Table)
+		{
+			return;
+		}
+
+		TagTable->CopyToDataTable(*Table);
+		Table->MarkPackageDirty();
+		UE_LOG(LogTemp, Display, TEXT("TagGen.ConvertToDataTable: %d rows of %s copied to %s"),
+			TagTable->Num(), *TagTable->GetName(), *Table->GetPathName());
+	}
+
+	static FAutoConsoleCommand ConvertToTagTable(
+		TEXT("TagGen.ConvertToTagTable"),
+		TEXT("Copies a tag-keyed data table into a gameplay tag data table, created next to it unless a package is given. Usage: TagGen.ConvertToTagTable <DataTablePath> [PackageName]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&ConvertToTagTableCommand));
+
+	static FAutoConsoleCommand ConvertToDataTable(
+		TEXT("TagGen.ConvertToDataTable"),
+		TEXT("Copies a gameplay tag data table into a data table named by tag, created next to it unless a package is given. Usage: TagGen.ConvertToDataTable <TagTablePath> [PackageName]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&ConvertToDataTableCommand));
+}
@@ -0,0 +1,145 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "GenerateNativeGameplayTagsCommandlet.h"
+#include "Async/ParallelFor.h"
+#include "DataTableGameplayTagEditorSettings.h"
+#include "GameplayTagCodeGenerator.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+UGenerateNativeGameplayTagsCommandlet::UGenerateNativeGameplayTagsCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+bool UGenerateNativeGameplayTagsCommandlet::LoadEntries(const FString& ConfigPath, TArray<FNativeTagGenEntry>& OutEntries)
+{
+	if (ConfigPath.IsEmpty())
+	{
+		OutEntries = GetDefault<UDataTableGameplayTagEditorSettings>()->GeneratedTables;
+		return true;
+	}
+
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *ConfigPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Cannot read %s"), *ConfigPath);
+		return false;
+	}
+	if (!FJsonObjectConverter::JsonArrayStringToUStruct(Json, &OutEntries))
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s is not a JSON array of generator entries"), *ConfigPath);
+		return false;
+	}
+	return true;
+}
+
+int32 UGenerateNativeGameplayTagsCommandlet::Main(const FString& Params)
+{
+	FString ConfigPath;
+	FParse::Value(*Params, TEXT("Config="), ConfigPath);
+
+	TArray<FNativeTagGenEntry> Entries;
+	if (!LoadEntries(ConfigPath, Entries))
+	{
+		return 1;
+	}
+
+	// Loading and reading the tables must happen on the game thread; formatting and writing run in parallel.
+	struct FJob
+	{
+		FString TablePath;
+		TArray<FName> Tags;
+		TArray<FName> RowNames;
+		FTagGenSettings Settings;
+		FTagGenResult Result;
+		bool bOk = false;
+	};
+
+	TArray<FJob> Jobs;
+	Jobs.Reserve(Entries.Num());
+	bool bAllOk = true;
+
+	// Two jobs writing the same files would race, and each would delete the other's outputs as stale
+	TMap<FString, FString> OutputOwners;
+	for (const FNativeTagGenEntry& Entry : Entries)
+	{
+		const UDataTable* Table = Entry.Table.LoadSynchronous();
+		if (!Table)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Cannot load table %s"), *Entry.Table.ToString());
+			bAllOk = false;
+			continue;
+		}
+
+		FJob Job;
+		if (!FGameplayTagCodeGenerator::MakeSettings(Entry, Job.Settings))
+		{
+			bAllOk = false;
+			continue;
+		}
+		Job.TablePath = Table->GetPathName();
+
+		FString HeaderPath, SourcePath;
+		FGameplayTagCodeGenerator::ComputeOutputPaths(Job.Settings.ModuleSourcePath, Job.Settings.RelPath, Job.Settings.FileStem, HeaderPath, SourcePath);
+		FPaths::NormalizeFilename(HeaderPath);
+		FPaths::NormalizeFilename(SourcePath);
+		const FString* Owner = OutputOwners.Find(HeaderPath);
+		Owner = Owner ? Owner : OutputOwners.Find(SourcePath);
+		if (Owner)
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s would generate the same files as %s (%s); it is skipped"), *Job.TablePath, **Owner, *HeaderPath);
+			bAllOk = false;
+			continue;
+		}
+		OutputOwners.Add(HeaderPath, Job.TablePath);
+		OutputOwners.Add(SourcePath, Job.TablePath);
+
+		FGameplayTagCodeGenerator::GatherTags(*Table, Job.Tags);
+		if (Job.Settings.bEmitRowIndex)
+		{
+			FGameplayTagCodeGenerator::GatherRowNames(*Table, Job.RowNames);
+		}
+		if (Job.Settings.bEmitRowData)
+		{
+			const TSharedRef<FTagGenRowData> RowData = MakeShared<FTagGenRowData>();
+			if (!FGameplayTagCodeGenerator::GatherRowData(*Table, *RowData))
+			{
+				bAllOk = false;
+				continue;
+			}
+			Job.Settings.RowData = RowData;
+		}
+		Job.Settings.TablePath = Job.TablePath;
+		Jobs.Add(MoveTemp(Job));
+	}
+
+	ParallelFor(Jobs.Num(), [&Jobs](int32 Index)
+	{
+		FJob& Job = Jobs[Index];
+		Job.bOk = FGameplayTagCodeGenerator::Generate(Job.Tags, Job.RowNames, Job.Settings, Job.Result);
+	});
+
+	int32 NumWritten = 0;
+	for (const FJob& Job : Jobs)
+	{
+		if (!Job.bOk)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to generate gameplay tags for %s"), *Job.TablePath);
+			bAllOk = false;
+			continue;
+		}
+
+		NumWritten += Job.Result.WrittenFiles.Num();
+		UE_LOG(LogTemp, Display, TEXT("%s: %d tag(s) added, %d removed, %d file(s) written, %d unchanged, %d deleted"),
+			*Job.TablePath, Job.Result.AddedTags.Num(), Job.Result.RemovedTags.Num(),
+			Job.Result.WrittenFiles.Num(), Job.Result.UnchangedFiles.Num(), Job.Result.DeletedFiles.Num());
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("GenerateNativeGameplayTags: %d table(s), %d file(s) written"), Jobs.Num(), NumWritten);
+	return bAllOk ? 0 : 1;
+}
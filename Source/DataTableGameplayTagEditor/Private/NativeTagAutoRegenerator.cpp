@@ -0,0 +1,141 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "NativeTagAutoRegenerator.h"
+#include "Async/Async.h"
+#include "DataTableGameplayTagEditorSettings.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "GameplayTagCodeGenerator.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+#define LOCTEXT_NAMESPACE "NativeTagAutoRegenerator"
+
+void FNativeTagAutoRegenerator::Start()
+{
+	SavedHandle = UPackage::PackageSavedWithContextEvent.AddSP(this, &FNativeTagAutoRegenerator::OnPackageSaved);
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FNativeTagAutoRegenerator::Tick), 0.25f);
+}
+
+void FNativeTagAutoRegenerator::Stop()
+{
+	UPackage::PackageSavedWithContextEvent.Remove(SavedHandle);
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	UE::Tasks::Wait(Tasks);
+	Tasks.Reset();
+	Pending.Reset();
+}
+
+void FNativeTagAutoRegenerator::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+	const UDataTableGameplayTagEditorSettings* Settings = GetDefault<UDataTableGameplayTagEditorSettings>();
+	if (!Settings->bRegenerateOnSave || SaveContext.IsProceduralSave() || !Package)
+	{
+		return;
+	}
+
+	const FName PackageName = Package->GetFName();
+	const double Due = FPlatformTime::Seconds() + Settings->RegenerateDelay;
+	for (const FNativeTagGenEntry& Entry : Settings->GeneratedTables)
+	{
+		const FSoftObjectPath& TablePath = Entry.Table.ToSoftObjectPath();
+		if (TablePath.GetLongPackageFName() == PackageName)
+		{
+			// Every save pushes the deadline back
+			Pending.Add(TablePath, Due);
+		}
+	}
+}
+
+bool FNativeTagAutoRegenerator::Tick(float DeltaTime)
+{
+	Tasks.RemoveAll([](const UE::Tasks::FTask& Task) { return Task.IsCompleted(); });
+
+	const double Now = FPlatformTime::Seconds();
+	for (auto It = Pending.CreateIterator(); It; ++It)
+	{
+		if (It->Value <= Now && !Running.Contains(It->Key))
+		{
+			const FSoftObjectPath TablePath = It->Key;
+			It.RemoveCurrent();
+			Launch(TablePath);
+		}
+	}
+	return true;
+}
+
+void FNativeTagAutoRegenerator::Launch(const FSoftObjectPath& TablePath)
+{
+	const FNativeTagGenEntry* Entry = GetDefault<UDataTableGameplayTagEditorSettings>()->FindEntry(TablePath);
+	const UDataTable* Table = Cast<UDataTable>(TablePath.ResolveObject());
+	if (!Entry || !Table)
+	{
+		return;
+	}
+
+	FTagGenSettings Settings;
+	if (!FGameplayTagCodeGenerator::MakeSettings(*Entry, Settings))
+	{
+		return;
+	}
+
+	// The table may be edited again while the task runs, so it is only read here
+	TArray<FName> Tags;
+	FGameplayTagCodeGenerator::GatherTags(*Table, Tags);
+	TArray<FName> RowNames;
+	if (Settings.bEmitRowIndex)
+	{
+		FGameplayTagCodeGenerator::GatherRowNames(*Table, RowNames);
+	}
+	if (Settings.bEmitRowData)
+	{
+		const TSharedRef<FTagGenRowData> RowData = MakeShared<FTagGenRowData>();
+		if (!FGameplayTagCodeGenerator::GatherRowData(*Table, *RowData))
+		{
+			return;
+		}
+		Settings.RowData = RowData;
+	}
+	Settings.TablePath = Table->GetPathName();
+
+	Running.Add(TablePath);
+	TWeakPtr<FNativeTagAutoRegenerator> WeakThis = AsShared();
+	Tasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, TablePath, Tags = MoveTemp(Tags), RowNames = MoveTemp(RowNames), Settings = MoveTemp(Settings)]()
+	{
+		FTagGenResult Result;
+		const bool bOk = FGameplayTagCodeGenerator::Generate(Tags, RowNames, Settings, Result);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, TablePath, bOk, Result = MoveTemp(Result)]()
+		{
+			if (const TSharedPtr<FNativeTagAutoRegenerator> This = WeakThis.Pin())
+			{
+				This->OnFinished(TablePath, bOk, Result);
+			}
+		});
+	}));
+}
+
+void FNativeTagAutoRegenerator::OnFinished(const FSoftObjectPath& TablePath, bool bOk, const FTagGenResult& Result)
+{
+	Running.Remove(TablePath);
+	FGameplayTagCodeGenerator::LogResult(Result);
+
+	if (!bOk)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to regenerate gameplay tag files for %s"), *TablePath.ToString());
+	}
+	else if (Result.IsUpToDate())
+	{
+		return;
+	}
+
+	FNotificationInfo Info(bOk
+		? FText::Format(LOCTEXT("Regenerated", "Native gameplay tags of {0} regenerated: {1} file(s) written, {2} deleted."),
+			FText::FromString(TablePath.GetAssetName()), Result.WrittenFiles.Num(), Result.DeletedFiles.Num())
+		: FText::Format(LOCTEXT("RegenerateFailed", "Failed to regenerate native gameplay tags of {0}. Check the log for details."),
+			FText::FromString(TablePath.GetAssetName())));
+	Info.ExpireDuration = 5.f;
+	FSlateNotificationManager::Get().AddNotification(Info);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,42 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Tasks/Task.h"
+#include "UObject/SoftObjectPath.h"
+
+struct FTagGenResult;
+class FObjectPostSaveContext;
+
+/**
+ * Regenerates the native tag files of a remembered table in the background once it has been saved.
+ *
+ * Saves are debounced per table so a burst of saves regenerates once. Tags are gathered on the game thread,
+ * formatting and writing happen in a task, and only files whose content changed are written.
+ */
+class FNativeTagAutoRegenerator : public TSharedFromThis<FNativeTagAutoRegenerator>
+{
+public:
+	void Start();
+
+	/** Unbinds and waits for the runs in flight. */
+	void Stop();
+
+private:
+	void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext);
+	bool Tick(float DeltaTime);
+	void Launch(const FSoftObjectPath& TablePath);
+	void OnFinished(const FSoftObjectPath& TablePath, bool bOk, const FTagGenResult& Result);
+
+	/** Tables saved recently, with the time they become due. */
+	TMap<FSoftObjectPath, double> Pending;
+
+	/** Tables with a run in flight; a save meanwhile waits for it so runs never overlap on the same files. */
+	TSet<FSoftObjectPath> Running;
+
+	TArray<UE::Tasks::FTask> Tasks;
+	FDelegateHandle SavedHandle;
+	FTSTicker::FDelegateHandle TickerHandle;
+};
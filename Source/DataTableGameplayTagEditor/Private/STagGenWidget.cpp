@@ -1,4 +1,9 @@
 ﻿#include "STagGenWidget.h"
+#include "DataTableGameplayTagEditor.h"
+#include "DataTableGameplayTagEditorSettings.h"
+#include "DataTableTagAssetTags.h"
+#include "GameplayTagCodeGenerator.h"
+#include "TagTableBlobExporter.h"
 #include "AssetRegistry/AssetData.h"
 #include "ContentBrowserModule.h"
 #include "GameplayTagsManager.h"
@@ -10,10 +15,13 @@
 #include "DesktopPlatformModule.h"
 #include "Widgets/Input/SEditableTextBox.h"
 #include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
 #include "Widgets/Input/SComboBox.h"
+#include "Widgets/Input/SSpinBox.h"
 #include "Widgets/Layout/SScrollBox.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Layout/SBox.h"
+#include "Widgets/Views/STableRow.h"
 #include "Styling/AppStyle.h"
 
 #define LOCTEXT_NAMESPACE "GameplayTagGen"
@@ -34,6 +42,11 @@ void STagGenWidget::Construct(const FArguments&)
     ensure(Modules.Num() > 0);
     SelectedModule = Modules[0];
     RelPath.Empty();
+
+    for (ETagGenSharding Option : { ETagGenSharding::None, ETagGenSharding::ByRoot, ETagGenSharding::ByCount })
+    {
+        ShardingOptions.Emplace(MakeShared<ETagGenSharding>(Option));
+    }
     
     // Helper lambdas
     auto MakeLabel = [](const FText& Txt)
@@ -94,7 +107,7 @@ void STagGenWidget::Construct(const FArguments&)
                         [
                             SNew(SEditableTextBox)
                             .Text_Lambda([this]{ return FText::FromString(NamespaceName); })
-                            .OnTextChanged_Lambda([this](const FText& T){ NamespaceName = T.ToString().TrimStartAndEnd(); })
+                            .OnTextChanged_Lambda([this](const FText& T){ NamespaceName = T.ToString().TrimStartAndEnd(); RefreshPreview(); })
                         ]
                         + SGridPanel::Slot(0,1).VAlign(VAlign_Center).Padding(2)
                         [ MakeLabel(LOCTEXT("StemLabel", "File name")) ]
@@ -102,7 +115,60 @@ void STagGenWidget::Construct(const FArguments&)
                         [
                             SNew(SEditableTextBox)
                             .Text_Lambda([this]{ return FText::FromString(FileStem); })
-                            .OnTextChanged_Lambda([this](const FText& T){ FileStem = T.ToString().TrimStartAndEnd(); })
+                            .OnTextChanged_Lambda([this](const FText& T){ FileStem = T.ToString().TrimStartAndEnd(); RefreshPreview(); })
+                        ]
+                        + SGridPanel::Slot(0,2).VAlign(VAlign_Center).Padding(2)
+                        [ MakeLabel(LOCTEXT("ShardLabel", "Split files")) ]
+                        + SGridPanel::Slot(1,2).Padding(2)
+                        [
+                            SNew(SHorizontalBox)
+                            + SHorizontalBox::Slot().AutoWidth()
+                            [ MakeShardingCombo() ]
+                            + SHorizontalBox::Slot().FillWidth(1.f).Padding(4,0,0,0)
+                            [
+                                SNew(SSpinBox<int32>)
+                                .MinValue(1)
+                                .ToolTipText(LOCTEXT("TagsPerShardTT", "Tags per file"))
+                                .Value_Lambda([this]{ return TagsPerShard; })
+                                .OnValueChanged_Lambda([this](int32 V){ TagsPerShard = V; RefreshPreview(); })
+                                .Visibility_Lambda([this]{ return Sharding == ETagGenSharding::ByCount ? EVisibility::Visible : EVisibility::Collapsed; })
+                            ]
+                        ]
+                        + SGridPanel::Slot(0,3).VAlign(VAlign_Center).Padding(2)
+                        [ MakeLabel(LOCTEXT("BulkLabel", "Bulk registration")) ]
+                        + SGridPanel::Slot(1,3).Padding(2)
+                        [
+                            SNew(SCheckBox)
+                            .ToolTipText(LOCTEXT("BulkTT", "Register all tags from one constexpr array instead of one static object per tag. Tags are then used through TAG_Name() accessors."))
+                            .IsChecked_Lambda([this]{ return bBulkRegistration ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+                            .OnCheckStateChanged_Lambda([this](ECheckBoxState State){ bBulkRegistration = State == ECheckBoxState::Checked; RefreshPreview(); })
+                        ]
+                        + SGridPanel::Slot(0,4).VAlign(VAlign_Center).Padding(2)
+                        [ MakeLabel(LOCTEXT("HierarchyLabel", "Hierarchy table")) ]
+                        + SGridPanel::Slot(1,4).Padding(2)
+                        [
+                            SNew(SCheckBox)
+                            .ToolTipText(LOCTEXT("HierarchyTT", "Also write <File>Hierarchy.h: every tag and parent numbered in pre-order, with constexpr parent and subtree-end arrays so IsChildOf is an integer range check."))
+                            .IsChecked_Lambda([this]{ return bEmitHierarchy ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+                            .OnCheckStateChanged_Lambda([this](ECheckBoxState State){ bEmitHierarchy = State == ECheckBoxState::Checked; RefreshPreview(); })
+                        ]
+                        + SGridPanel::Slot(0,5).VAlign(VAlign_Center).Padding(2)
+                        [ MakeLabel(LOCTEXT("RowIndexLabel", "Row index header")) ]
+                        + SGridPanel::Slot(1,5).Padding(2)
+                        [
+                            SNew(SCheckBox)
+                            .ToolTipText(LOCTEXT("RowIndexTT", "Also write <File>Rows.h: a stable integer index per row with a checksum validated at load, so native code can fetch rows without hashing names."))
+                            .IsChecked_Lambda([this]{ return bEmitRowIndex ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+                            .OnCheckStateChanged_Lambda([this](ECheckBoxState State){ bEmitRowIndex = State == ECheckBoxState::Checked; RefreshPreview(); })
+                        ]
+                        + SGridPanel::Slot(0,6).VAlign(VAlign_Center).Padding(2)
+                        [ MakeLabel(LOCTEXT("RowDataLabel", "Row data header")) ]
+                        + SGridPanel::Slot(1,6).Padding(2)
+                        [
+                            SNew(SCheckBox)
+                            .ToolTipText(LOCTEXT("RowDataTT", "Also write <File>Data.h: every row baked into a constexpr array indexed by one constant per row, for tables whose fields are all bools, numbers or enums. Warns at startup when the asset no longer matches."))
+                            .IsChecked_Lambda([this]{ return bEmitRowData ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+                            .OnCheckStateChanged_Lambda([this](ECheckBoxState State){ bEmitRowData = State == ECheckBoxState::Checked; RefreshPreview(); })
                         ]
                     ]
 
@@ -142,6 +208,15 @@ void STagGenWidget::Construct(const FArguments&)
                                 .IsEnabled_Lambda([this] { return CanGenerate(); })
                                 .OnClicked(this, &STagGenWidget::OnGenerateClicked)
                             ]
+                            // Binary export for tools running without the engine
+                            + SHorizontalBox::Slot().AutoWidth().Padding(4,0)
+                            [
+                                SNew(SButton)
+                                .Text(LOCTEXT("ExportBlob", "Export binary..."))
+                                .ToolTipText(LOCTEXT("ExportBlobTT", "Write the selected table to a memory-mappable blob with a perfect hash over its tags, readable through TagTableBlob.h."))
+                                .IsEnabled_Lambda([this] { return SourceTable.IsValid(); })
+                                .OnClicked(this, &STagGenWidget::OnExportBlobClicked)
+                            ]
                         ]
                     ]
 
@@ -179,35 +254,60 @@ void STagGenWidget::Construct(const FArguments&)
                    .BorderImage(FAppStyle::Get().GetBrush("Brushes.Title"))
                    .Padding(4)
                    [
-                       SNew(SScrollBox)
+                       SNew(SVerticalBox)
 
-                       // Header preview
-                       + SScrollBox::Slot().Padding(2,12,2,2)
-                       [ SNew(STextBlock).Text(LOCTEXT("HeaderPrevLbl", "Header:")).ColorAndOpacity(FLinearColor::Green) ] 
-                       + SScrollBox::Slot().Padding(24)
+                       + SVerticalBox::Slot().AutoHeight().Padding(2)
                        [
-                           SNew(SBox).MinDesiredHeight(90)
-                           [
-                               SNew(STextBlock)
-                               .Font(FAppStyle::GetFontStyle("Monospaced"))
-                               .Text(this, &STagGenWidget::GetHeaderPreviewText)
-                               .ColorAndOpacity(FLinearColor::White)          // white on dark bg
-                           ]
+                           SNew(SCheckBox)
+                           .ToolTipText(LOCTEXT("FullPreviewTT", "Preview every generated line instead of the first rows."))
+                           .IsChecked_Lambda([this]{ return bFullPreview ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+                           .OnCheckStateChanged_Lambda([this](ECheckBoxState State){ bFullPreview = State == ECheckBoxState::Checked; RefreshPreview(); })
+                           [ SNew(STextBlock).Text(LOCTEXT("FullPreviewLbl", "Full preview")) ]
                        ]
 
-                       // Source preview
-                       + SScrollBox::Slot().Padding(2,12,2,2)
-                       [ SNew(STextBlock).Text(LOCTEXT("SourcePrevLbl", "Source:")).ColorAndOpacity(FLinearColor::Green) ]
-                       + SScrollBox::Slot().Padding(24)
+                       + SVerticalBox::Slot().FillHeight(1.f)
                        [
-                           SNew(SBox).MinDesiredHeight(90)
+                           SNew(SScrollBox)
+                           .Visibility_Lambda([this]{ return bFullPreview ? EVisibility::Collapsed : EVisibility::Visible; })
+
+                           // Header preview
+                           + SScrollBox::Slot().Padding(2,12,2,2)
+                           [ SNew(STextBlock).Text(LOCTEXT("HeaderPrevLbl", "Header:")).ColorAndOpacity(FLinearColor::Green) ] 
+                           + SScrollBox::Slot().Padding(24)
+                           [
+                               SNew(SBox).MinDesiredHeight(90)
+                               [
+                                   SNew(STextBlock)
+                                   .Font(FAppStyle::GetFontStyle("Monospaced"))
+                                   .Text(this, &STagGenWidget::GetHeaderPreviewText)
+                                   .ColorAndOpacity(FLinearColor::White)          // white on dark bg
+                               ]
+                           ]
+
+                           // Source preview
+                           + SScrollBox::Slot().Padding(2,12,2,2)
+                           [ SNew(STextBlock).Text(LOCTEXT("SourcePrevLbl", "Source:")).ColorAndOpacity(FLinearColor::Green) ]
+                           + SScrollBox::Slot().Padding(24)
                            [
-                               SNew(STextBlock)
-                               .Font(FAppStyle::GetFontStyle("Monospaced"))
-                               .Text(this, &STagGenWidget::GetSourcePreviewText)
-                               .ColorAndOpacity(FLinearColor::White)
+                               SNew(SBox).MinDesiredHeight(90)
+                               [
+                                   SNew(STextBlock)
+                                   .Font(FAppStyle::GetFontStyle("Monospaced"))
+                                   .Text(this, &STagGenWidget::GetSourcePreviewText)
+                                   .ColorAndOpacity(FLinearColor::White)
+                               ]
                            ]
                        ]
+
+                       // Full preview: a list view only creates widgets for the visible lines
+                       + SVerticalBox::Slot().FillHeight(1.f)
+                       [
+                           SAssignNew(PreviewList, SListView<TSharedPtr<FString>>)
+                           .Visibility_Lambda([this]{ return bFullPreview ? EVisibility::Visible : EVisibility::Collapsed; })
+                           .ListItemsSource(&PreviewLines)
+                           .SelectionMode(ESelectionMode::None)
+                           .OnGenerateRow(this, &STagGenWidget::MakePreviewLineRow)
+                       ]
                    ]
                 ]
             ]
@@ -222,6 +322,42 @@ void STagGenWidget::Construct(const FArguments&)
             ]*/
         ]
     ];
+
+    RefreshPreview();
+}
+
+void STagGenWidget::OnSourceTableSelected(UDataTable* Table)
+{
+    if (UDataTable* OldTable = SourceTable.Get())
+    {
+        OldTable->OnDataTableChanged().Remove(TableChangedHandle);
+    }
+    TableChangedHandle.Reset();
+
+    SourceTable = Table;
+    if (Table)
+    {
+        // Start from the settings this table was last generated with
+        if (const FNativeTagGenEntry* Entry = GetDefault<UDataTableGameplayTagEditorSettings>()->FindEntry(FSoftObjectPath(Table)))
+        {
+            ApplyEntry(*Entry);
+        }
+
+        // Row edits change the previews as much as the inputs do
+        TableChangedHandle = Table->OnDataTableChanged().AddSP(this, &STagGenWidget::RefreshPreview);
+    }
+    RefreshPreview();
+}
+
+TSharedRef<ITableRow> STagGenWidget::MakePreviewLineRow(TSharedPtr<FString> Line, const TSharedRef<STableViewBase>& OwnerTable)
+{
+    return SNew(STableRow<TSharedPtr<FString>>, OwnerTable)
+        [
+            SNew(STextBlock)
+            .Font(FAppStyle::GetFontStyle("Monospaced"))
+            .Text(FText::FromString(*Line))
+            .ColorAndOpacity(FLinearColor::White)
+        ];
 }
 
 TSharedRef<SWidget> STagGenWidget::MakeDataTablePicker()
@@ -229,17 +365,22 @@ TSharedRef<SWidget> STagGenWidget::MakeDataTablePicker()
     FAssetPickerConfig Picker;
     Picker.Filter.ClassPaths.Add(UDataTable::StaticClass()->GetClassPathName());
 
-    // Filter out any non gameplay tag tables.
-    Picker.Filter.TagsAndValues.Add(
-        FName("RowStructure"),
-        FString("/Script/GameplayTags.GameplayTagTableRow") 
-    );
-    
+    // Gameplay tag tables and any table keyed by tags are accepted, so no row structure filter. Tables whose
+    // asset registry tags say their row names are not tags are hidden without loading them.
+    Picker.OnShouldFilterAsset = FOnShouldFilterAsset::CreateLambda([](const FAssetData& Asset)
+    {
+        FString RowStructure;
+        if (Asset.GetTagValue(TEXT("RowStructure"), RowStructure) && RowStructure.EndsWith(TEXT("GameplayTagTableRow")))
+        {
+            return false;
+        }
+        return !FDataTableTagAssetTags::IsTagKeyed(Asset).Get(true);
+    });
     Picker.SelectionMode           = ESelectionMode::Single;
     Picker.bAllowNullSelection     = false;
     Picker.OnAssetSelected = FOnAssetSelected::CreateLambda([this](const FAssetData& Asset)
     {
-        SourceTable = Cast<UDataTable>(Asset.GetAsset());
+        OnSourceTableSelected(Cast<UDataTable>(Asset.GetAsset()));
     });
 
     return FModuleManager::LoadModuleChecked<FContentBrowserModule>("ContentBrowser").Get().CreateAssetPicker(Picker);
@@ -254,6 +395,7 @@ TSharedRef<SWidget> STagGenWidget::MakeModuleCombo()
         {
             SelectedModule = NewSel;
             RelPath.Empty();
+            RefreshPreview();
         })
         .OnGenerateWidget_Lambda([](TSharedPtr<FModuleContextInfo> M)
         {
@@ -264,6 +406,38 @@ TSharedRef<SWidget> STagGenWidget::MakeModuleCombo()
         ];
 }
 
+TSharedRef<SWidget> STagGenWidget::MakeShardingCombo()
+{
+    auto GetOptionText = [](ETagGenSharding Option)
+    {
+        switch (Option)
+        {
+        case ETagGenSharding::ByRoot:  return LOCTEXT("ShardByRoot", "One file per tag root");
+        case ETagGenSharding::ByCount: return LOCTEXT("ShardByCount", "One file per N tags");
+        default:                       return LOCTEXT("ShardNone", "Single file");
+        }
+    };
+
+    return SNew(SComboBox<TSharedPtr<ETagGenSharding>>)
+        .OptionsSource(&ShardingOptions)
+        .InitiallySelectedItem(ShardingOptions[0])
+        .OnSelectionChanged_Lambda([this](TSharedPtr<ETagGenSharding> NewSel, ESelectInfo::Type)
+        {
+            if (NewSel.IsValid())
+            {
+                Sharding = *NewSel;
+                RefreshPreview();
+            }
+        })
+        .OnGenerateWidget_Lambda([GetOptionText](TSharedPtr<ETagGenSharding> Option)
+        {
+            return SNew(STextBlock).Text(GetOptionText(*Option));
+        })
+        [
+            SNew(STextBlock).Text_Lambda([this, GetOptionText]{ return GetOptionText(Sharding); })
+        ];
+}
+
 FReply STagGenWidget::OnChooseFolderClicked()
 {
     IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
@@ -287,16 +461,69 @@ FReply STagGenWidget::OnChooseFolderClicked()
         Rel.RemoveFromStart(TEXT("/"));
         Rel.RemoveFromEnd(TEXT("/"));
         RelPath = Rel;
+        RefreshPreview();
+    }
+    return FReply::Handled();
+}
+
+FReply STagGenWidget::OnExportBlobClicked()
+{
+    IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+    if (!DesktopPlatform || !SourceTable.IsValid())
+        return FReply::Handled();
+
+    TSharedPtr<SWindow> ParentWindow = FSlateApplication::Get().FindWidgetWindow(AsShared());
+    void* ParentWindowHandle = ParentWindow.IsValid() ? ParentWindow->GetNativeWindow()->GetOSWindowHandle() : nullptr;
+
+    TArray<FString> Files;
+    const bool bPicked = DesktopPlatform->SaveFileDialog(
+        ParentWindowHandle,
+        TEXT("Export Tag Table"),
+        FPaths::ProjectSavedDir(),
+        SourceTable->GetName() + TEXT(".dtgb"),
+        TEXT("Tag table blob (*.dtgb)|*.dtgb"),
+        EFileDialogFlags::None,
+        Files
+    );
+    if (!bPicked || Files.Num() == 0)
+        return FReply::Handled();
+
+    // Every row is read back through the standalone reader before the file is written
+    FString Error;
+    if (FTagTableBlobExporter::ExportToFile(*SourceTable, Files[0], Error))
+    {
+        FMessageDialog::Open(EAppMsgType::Ok, FText::Format(LOCTEXT("ExportBlobDone", "{0} rows exported and verified:\n{1}"),
+            SourceTable->GetRowMap().Num(), FText::FromString(Files[0])));
+    }
+    else
+    {
+        FMessageDialog::Open(EAppMsgType::Ok, FText::Format(LOCTEXT("ExportBlobFail", "Export failed: {0}"), FText::FromString(Error)));
     }
     return FReply::Handled();
 }
 
-FText STagGenWidget::GetPathPreviewText() const
+FText STagGenWidget::BuildPathPreview() const
 {
+    if (!SelectedModule.IsValid())
+    {
+        return FText::GetEmpty();
+    }
+
     FString HeaderPath, SourcePath;
     ComputeOutputPaths(HeaderPath, SourcePath);
 
-    FString Preview = FString::Printf(TEXT("Will generate:\n\n%s\n%s"), *HeaderPath, *SourcePath);
+    FString Preview;
+    if (Sharding == ETagGenSharding::None)
+    {
+        Preview = FString::Printf(TEXT("Will generate:\n\n%s\n%s"), *HeaderPath, *SourcePath);
+    }
+    else
+    {
+        // One pair per shard behind an umbrella header
+        FString ShardHeader, ShardSource;
+        FGameplayTagCodeGenerator::ComputeOutputPaths(SelectedModule->ModuleSourcePath, RelPath, FileStem + TEXT("_<Shard>"), ShardHeader, ShardSource);
+        Preview = FString::Printf(TEXT("Will generate:\n\n%s\n%s\n%s"), *HeaderPath, *ShardHeader, *ShardSource);
+    }
     return FText::FromString(Preview);
 }
 
@@ -325,131 +552,109 @@ FReply STagGenWidget::OnGenerateClicked()
             return FReply::Handled();
     }
 
-    if (WriteFiles())
+    FTagGenResult Result;
+    if (!WriteFiles(Result))
+    {
+        FMessageDialog::Open(EAppMsgType::Ok, LOCTEXT("Fail", "Failed to write files. Check the log for details."));
+        return FReply::Handled();
+    }
+
+    // Also when nothing changed, so the table is regenerated on save from now on
+    FDataTableGameplayTagEditorModule::Get().RememberSettings(MakeEntry());
+    if (Result.IsUpToDate())
     {
-        FMessageDialog::Open(EAppMsgType::Ok, LOCTEXT("Success", "Gameplay‑tag files generated."));
+        FMessageDialog::Open(EAppMsgType::Ok, LOCTEXT("UpToDate", "Gameplay‑tag files are already up to date. Nothing was written."));
     }
     else
     {
-        FMessageDialog::Open(EAppMsgType::Ok, LOCTEXT("Fail", "Failed to write files. Check the log for details."));
+        FMessageDialog::Open(EAppMsgType::Ok, FText::Format(LOCTEXT("SuccessFmt",
+            "Gameplay‑tag files generated.\n{0} tag(s) added, {1} removed.\n{2} file(s) written, {3} unchanged, {4} deleted."),
+            Result.AddedTags.Num(), Result.RemovedTags.Num(), Result.WrittenFiles.Num(), Result.UnchangedFiles.Num(), Result.DeletedFiles.Num()));
     }
     return FReply::Handled();
 }
 
-FString STagGenWidget::SafeName(const FName& Tag)
+void STagGenWidget::ComputeOutputPaths(FString& OutHeader, FString& OutSource) const
 {
-    FString R = Tag.ToString();
-    R.ReplaceInline(TEXT("."), TEXT("_"));
-    return R;
+    check(SelectedModule.IsValid());
+    FGameplayTagCodeGenerator::ComputeOutputPaths(SelectedModule->ModuleSourcePath, RelPath, FileStem, OutHeader, OutSource);
 }
 
-FString STagGenWidget::BuildHeader(const TArray<FGameplayTagTableRow*>& Rows, const FString& NS)
+FString STagGenWidget::ComputeHeaderInclude() const
 {
-    static constexpr TCHAR HeaderTpl[] =
-       TEXT("#pragma once\n\n#include \"NativeGameplayTags.h\"\n\nnamespace %s\n{\n");
-    FString Out = FString::Printf(HeaderTpl, *NS);
-
-    for (const FGameplayTagTableRow* Row : Rows)
-    {
-        const FString Name = SafeName(Row->Tag);
-        Out += FString::Printf(TEXT("\tUE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_%s);\n"), *Name);
-    }
-    Out.Append(TEXT("}\n"));
-    return Out;
+    return FGameplayTagCodeGenerator::ComputeHeaderInclude(RelPath, FileStem);
 }
 
-FString STagGenWidget::BuildSource(const TArray<FGameplayTagTableRow*>& Rows, const FString& NS, const FString& HeaderPathWithExt)
+FTagGenSettings STagGenWidget::MakeSettings() const
 {
-    static constexpr TCHAR SrcTpl[] = TEXT("#include \"%s\"\n\nnamespace %s\n{\n");
-    FString Out = FString::Printf(SrcTpl, *HeaderPathWithExt, *NS);
+    check(SelectedModule.IsValid());
 
-    for (const FGameplayTagTableRow* Row : Rows)
-    {
-        const FString Name = SafeName(Row->Tag);
-        Out += FString::Printf(TEXT("\tUE_DEFINE_GAMEPLAY_TAG(TAG_%s, \"%s\");\n"), *Name, *Row->Tag.ToString());
-    }
-    Out.Append(TEXT("}\n"));
-    return Out;
+    FTagGenSettings Settings;
+    Settings.Namespace = NamespaceName;
+    Settings.ModuleSourcePath = SelectedModule->ModuleSourcePath;
+    Settings.RelPath = RelPath;
+    Settings.FileStem = FileStem;
+    Settings.Sharding = Sharding;
+    Settings.TagsPerShard = TagsPerShard;
+    Settings.Registration = bBulkRegistration ? ETagGenRegistration::BulkTable : ETagGenRegistration::PerTagObjects;
+    Settings.bEmitHierarchy = bEmitHierarchy;
+    Settings.bEmitRowIndex = bEmitRowIndex;
+    Settings.bEmitRowData = bEmitRowData;
+    return Settings;
 }
 
-void STagGenWidget::ComputeOutputPaths(FString& OutHeader, FString& OutSource) const
+FNativeTagGenEntry STagGenWidget::MakeEntry() const
 {
     check(SelectedModule.IsValid());
 
-    FString Root = SelectedModule->ModuleSourcePath;
-    FString PublicDir = Root / TEXT("Public");
-    FString PrivateDir = Root / TEXT("Private");
-    if (!RelPath.IsEmpty())
-    {
-        PublicDir /= RelPath;
-        PrivateDir /= RelPath;
-    }
-    FPaths::NormalizeDirectoryName(PublicDir);
-    FPaths::NormalizeDirectoryName(PrivateDir);
-    if (!PublicDir.EndsWith(TEXT("/"))) PublicDir.AppendChar('/');
-    if (!PrivateDir.EndsWith(TEXT("/"))) PrivateDir.AppendChar('/');
-
-    OutHeader = PublicDir / (FileStem + TEXT(".h"));
-    OutSource = PrivateDir / (FileStem + TEXT(".cpp"));
+    FNativeTagGenEntry Entry;
+    Entry.Table = SourceTable;
+    Entry.Module = SelectedModule->ModuleName;
+    Entry.RelPath = RelPath;
+    Entry.Namespace = NamespaceName;
+    Entry.FileStem = FileStem;
+    Entry.Sharding = Sharding;
+    Entry.TagsPerShard = TagsPerShard;
+    Entry.Registration = bBulkRegistration ? ETagGenRegistration::BulkTable : ETagGenRegistration::PerTagObjects;
+    Entry.bEmitHierarchy = bEmitHierarchy;
+    Entry.bEmitRowIndex = bEmitRowIndex;
+    Entry.bEmitRowData = bEmitRowData;
+    return Entry;
 }
 
-bool STagGenWidget::WriteFiles()
+void STagGenWidget::ApplyEntry(const FNativeTagGenEntry& Entry)
 {
-    check(SelectedModule.IsValid());
-
-    FString HeaderPath, SourcePath;
-    ComputeOutputPaths(HeaderPath, SourcePath);
-
-    // Create directory tree if needed
-    FString OutHeaderDir = FPaths::GetPath(HeaderPath);
-    FString OutSourceDir = FPaths::GetPath(SourcePath);
-    IFileManager& FM = IFileManager::Get();
-    if (!FM.MakeDirectory(*OutHeaderDir, /*Tree*/true))
-    {
-        UE_LOG(LogTemp, Error, TEXT("Cannot create directory %s"), *OutHeaderDir);
-        return false;
-    }
-    if (!FM.MakeDirectory(*OutSourceDir, /*Tree*/true))
-    {
-        UE_LOG(LogTemp, Error, TEXT("Cannot create directory %s"), *OutSourceDir);
-        return false;
-    }
-
-    // Gather rows
-    TArray<FGameplayTagTableRow*> Rows;
-    SourceTable->GetAllRows(TEXT("TagGenWidget"), Rows);
-
-    bool bOk = FFileHelper::SaveStringToFile(BuildHeader(Rows, NamespaceName), *HeaderPath);
-
-    // Compute the relative header include
-    FString IncludeRel;
-    if (!RelPath.IsEmpty())
-    {
-        IncludeRel = RelPath / (FileStem + TEXT(".h"));  
-    }
-    else
+    if (const TSharedPtr<FModuleContextInfo>* Module = Modules.FindByPredicate([&Entry](const TSharedPtr<FModuleContextInfo>& M) { return M->ModuleName == Entry.Module; }))
     {
-        IncludeRel = FileStem + TEXT(".h"); 
+        SelectedModule = *Module;
     }
+    RelPath = Entry.RelPath;
+    NamespaceName = Entry.Namespace;
+    FileStem = Entry.FileStem;
+    Sharding = Entry.Sharding;
+    TagsPerShard = Entry.TagsPerShard;
+    bBulkRegistration = Entry.Registration == ETagGenRegistration::BulkTable;
+    bEmitHierarchy = Entry.bEmitHierarchy;
+    bEmitRowIndex = Entry.bEmitRowIndex;
+    bEmitRowData = Entry.bEmitRowData;
+}
 
-    IncludeRel.ReplaceInline(TEXT("\\"), TEXT("/"));
+bool STagGenWidget::WriteFiles(FTagGenResult& OutResult)
+{
+    check(SelectedModule.IsValid());
 
-    bOk &= FFileHelper::SaveStringToFile(BuildSource(Rows, NamespaceName, IncludeRel), *SourcePath);
-    
+    // Unchanged files are skipped so their includers are not rebuilt
+    const bool bOk = FGameplayTagCodeGenerator::Generate(*SourceTable, MakeSettings(), OutResult);
     if (!bOk)
     {
         UE_LOG(LogTemp, Error, TEXT("Failed to write header or source file for gameplay tags"));
     }
-    return bOk;
-}
 
-bool STagGenWidget::CanGenerate() const
-{
-    return SourceTable.IsValid() && !NamespaceName.IsEmpty() &&
-           !FileStem.IsEmpty() && SelectedModule.IsValid();
+    FGameplayTagCodeGenerator::LogResult(OutResult);
+    return bOk;
 }
 
-FText STagGenWidget::GetErrorMessage() const
+FText STagGenWidget::ValidateInputs() const
 {
     if (!SourceTable.IsValid())
     {
@@ -474,48 +679,101 @@ FText STagGenWidget::GetErrorMessage() const
     return FText::GetEmpty();
 }
 
-FText STagGenWidget::GetHeaderPreviewText() const
+void STagGenWidget::GatherPreviewTags(TArray<FName>& OutTags) const
 {
-    if (!CanGenerate())
-    {
-        return FText::GetEmpty();     
-    }
-    
-    TArray<FGameplayTagTableRow*> Rows;
+    // Only the first 3 rows are shown in the preview
     if (SourceTable.IsValid())
     {
-        // Get the first 3 rows for preview (if there are more than 3)
-        SourceTable->GetAllRows(TEXT("TagGenWidgetPreview"), Rows);
-        if (Rows.Num() > 3)
-        {
-            Rows.SetNum(3);
-        }
+        FGameplayTagCodeGenerator::GatherTags(*SourceTable, OutTags, 3);
     }
-       
-    return FText::FromString(BuildHeader(Rows, NamespaceName));
 }
 
-FText STagGenWidget::GetSourcePreviewText() const
+void STagGenWidget::RefreshPreview()
 {
-    if (!CanGenerate())
+    ErrorMessage = ValidateInputs();
+    bCanGenerate = ErrorMessage.IsEmpty();
+    PathPreview = BuildPathPreview();
+    HeaderPreview = FText::GetEmpty();
+    SourcePreview = FText::GetEmpty();
+
+    if (bCanGenerate)
     {
-        return FText::GetEmpty();   
+        TArray<FName> Tags;
+        GatherPreviewTags(Tags);
+
+        const FTagGenSettings Settings = MakeSettings();
+        FGeneratedTagFile Header, Source;
+        FGameplayTagCodeGenerator::BuildFiles(Tags, Settings, ComputeHeaderInclude(), Header, Source);
+        HeaderPreview = FText::FromString(Header.ToString());
+        SourcePreview = FText::FromString(Source.ToString());
     }
 
-    TArray<FGameplayTagTableRow*> Rows;
-    if (SourceTable.IsValid())
+    // Typing in a text box refreshes on every key, so the full preview waits for the inputs to settle
+    if (FullPreviewTimer.IsValid())
+    {
+        UnRegisterActiveTimer(FullPreviewTimer.ToSharedRef());
+        FullPreviewTimer.Reset();
+    }
+    if (bFullPreview)
+    {
+        FullPreviewTimer = RegisterActiveTimer(0.3f, FWidgetActiveTimerDelegate::CreateSP(this, &STagGenWidget::RefreshFullPreview));
+    }
+    else if (PreviewLines.Num() > 0)
+    {
+        PreviewLines.Empty();
+        PreviewList->RequestListRefresh();
+    }
+}
+
+EActiveTimerReturnType STagGenWidget::RefreshFullPreview(double InCurrentTime, float InDeltaTime)
+{
+    FullPreviewTimer.Reset();
+    PreviewLines.Reset();
+
+    if (bCanGenerate && bFullPreview)
     {
-        // Get the first 3 rows for preview (if there are more than 3)
-        SourceTable->GetAllRows(TEXT("TagGenWidgetPreview"), Rows);
-        if (Rows.Num() > 3)
+        TArray<FName> Tags;
+        FGameplayTagCodeGenerator::GatherTags(*SourceTable, Tags);
+
+        const FTagGenSettings Settings = MakeSettings();
+        TArray<FGeneratedTagFile> Files;
+        FGameplayTagCodeGenerator::BuildOutputs(Tags, Settings, Files);
+        if (bEmitRowIndex)
+        {
+            TArray<FName> RowNames;
+            FGameplayTagCodeGenerator::GatherRowNames(*SourceTable, RowNames);
+
+            FTagGenSettings RowSettings = Settings;
+            RowSettings.TablePath = SourceTable->GetPathName();
+            FGameplayTagCodeGenerator::BuildRowIndex(RowNames, RowSettings, Files.AddDefaulted_GetRef());
+        }
+        if (bEmitRowData)
         {
-            Rows.SetNum(3);
+            const TSharedRef<FTagGenRowData> RowData = MakeShared<FTagGenRowData>();
+            if (FGameplayTagCodeGenerator::GatherRowData(*SourceTable, *RowData))
+            {
+                FTagGenSettings DataSettings = Settings;
+                DataSettings.TablePath = SourceTable->GetPathName();
+                DataSettings.RowData = RowData;
+                FGameplayTagCodeGenerator::BuildRowData(DataSettings, Files.AddDefaulted_GetRef());
+            }
+        }
+
+        for (const FGeneratedTagFile& File : Files)
+        {
+            PreviewLines.Emplace(MakeShared<FString>(FString::Printf(TEXT("// ---- %s"), *File.Path)));
+
+            TArray<FString> Lines;
+            File.ToString().ParseIntoArrayLines(Lines, /*InCullEmpty*/false);
+            for (FString& Line : Lines)
+            {
+                PreviewLines.Emplace(MakeShared<FString>(MoveTemp(Line)));
+            }
         }
     }
-    
-    FString IncludeRel = !RelPath.IsEmpty() ? RelPath / (FileStem + TEXT(".h")) : FileStem + TEXT(".h");
-    IncludeRel.ReplaceInline(TEXT("\\"), TEXT("/"));
-    return FText::FromString(BuildSource(Rows, NamespaceName, IncludeRel));
+
+    PreviewList->RequestListRefresh();
+    return EActiveTimerReturnType::Stop;
 }
 
 #undef LOCTEXT_NAMESPACE
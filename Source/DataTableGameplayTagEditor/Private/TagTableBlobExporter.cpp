@@ -0,0 +1,445 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "TagTableBlobExporter.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagContainer.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "TagPerfectHash.h"
+#include "TagTableBlob.h"
+
+namespace TagTableBlobExport
+{
+	using namespace DataTableTagBlob;
+
+	struct FFieldPlan
+	{
+		const FProperty* Property;
+		EFieldType Type;
+		uint32 Offset;
+	};
+
+	bool IsStringProperty(const FProperty* Property)
+	{
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			return StructProperty->Struct == FGameplayTag::StaticStruct();
+		}
+		return Property->IsA<FStrProperty>() || Property->IsA<FNameProperty>() || Property->IsA<FTextProperty>();
+	}
+
+	bool GetNumericType(const FNumericProperty* Numeric, EFieldType& OutType)
+	{
+		if (Numeric->IsA<FFloatProperty>())  { OutType = EFieldType::Float;  return true; }
+		if (Numeric->IsA<FDoubleProperty>()) { OutType = EFieldType::Double; return true; }
+		if (Numeric->IsA<FInt8Property>())   { OutType = EFieldType::Int8;   return true; }
+		if (Numeric->IsA<FByteProperty>())   { OutType = EFieldType::UInt8;  return true; }
+		if (Numeric->IsA<FInt16Property>())  { OutType = EFieldType::Int16;  return true; }
+		if (Numeric->IsA<FUInt16Property>()) { OutType = EFieldType::UInt16; return true; }
+		if (Numeric->IsA<FIntProperty>())    { OutType = EFieldType::Int32;  return true; }
+		if (Numeric->IsA<FUInt32Property>()) { OutType = EFieldType::UInt32; return true; }
+		if (Numeric->IsA<FInt64Property>())  { OutType = EFieldType::Int64;  return true; }
+		if (Numeric->IsA<FUInt64Property>()) { OutType = EFieldType::UInt64; return true; }
+		return false;
+	}
+
+	/** Numeric property behind a numeric or enum field. */
+	const FNumericProperty* GetNumeric(const FProperty* Property)
+	{
+		if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+		{
+			return EnumProperty->GetUnderlyingProperty();
+		}
+		return CastField<FNumericProperty>(Property);
+	}
+
+	bool GetFieldType(const FProperty* Property, EFieldType& OutType)
+	{
+		if (Property->ArrayDim != 1)
+		{
+			return false;
+		}
+		if (Property->IsA<FBoolProperty>())
+		{
+			OutType = EFieldType::Bool;
+			return true;
+		}
+		if (IsStringProperty(Property))
+		{
+			OutType = EFieldType::String;
+			return true;
+		}
+		const FNumericProperty* Numeric = GetNumeric(Property);
+		return Numeric && GetNumericType(Numeric, OutType);
+	}
+
+	FString GetStringValue(const FProperty* Property, const void* Value)
+	{
+		if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+		{
+			return StrProperty->GetPropertyValue(Value);
+		}
+		if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+		{
+			return NameProperty->GetPropertyValue(Value).ToString();
+		}
+		if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+		{
+			return TextProperty->GetPropertyValue(Value).ToString();
+		}
+		return static_cast<const FGameplayTag*>(Value)->ToString();
+	}
+
+	/** Writes a non-string field value in its exported representation. */
+	void EncodeScalar(const FFieldPlan& Field, const void* Value, uint8* Dest)
+	{
+		if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Field.Property))
+		{
+			*Dest = BoolProperty->GetPropertyValue(Value) ? 1 : 0;
+			return;
+		}
+
+		const FNumericProperty* Numeric = GetNumeric(Field.Property);
+		switch (Field.Type)
+		{
+		case EFieldType::Float:
+		{
+			const float Float = static_cast<float>(Numeric->GetFloatingPointPropertyValue(Value));
+			FMemory::Memcpy(Dest, &Float, sizeof(Float));
+			return;
+		}
+		case EFieldType::Double:
+		{
+			const double Double = Numeric->GetFloatingPointPropertyValue(Value);
+			FMemory::Memcpy(Dest, &Double, sizeof(Double));
+			return;
+		}
+		default:
+			// Little-endian truncation keeps the value for every integer width
+			const uint64 Bits = Numeric->IsA<FUInt64Property>() || Numeric->IsA<FUInt32Property>() || Numeric->IsA<FUInt16Property>() || Numeric->IsA<FByteProperty>()
+				? Numeric->GetUnsignedIntPropertyValue(Value)
+				: static_cast<uint64>(Numeric->GetSignedIntPropertyValue(Value));
+			FMemory::Memcpy(Dest, &Bits, FieldSize(Field.Type));
+			return;
+		}
+	}
+
+	uint32 FieldAlignment(EFieldType Type)
+	{
+		return Type == EFieldType::String ? alignof(FStringRef) : FieldSize(Type);
+	}
+
+	/** Reads a non-string field back through the reader as its exported type and compares it with the property value. */
+	bool ReadsBack(const FReader& Reader, const uint8* Row, const FField& Read, const FFieldPlan& Field, const void* Value)
+	{
+		if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Field.Property))
+		{
+			return Reader.Get<uint8_t>(Row, Read) == (BoolProperty->GetPropertyValue(Value) ? 1 : 0);
+		}
+
+		const FNumericProperty* Numeric = GetNumeric(Field.Property);
+		switch (Field.Type)
+		{
+		case EFieldType::Float:
+		{
+			const float Expected = static_cast<float>(Numeric->GetFloatingPointPropertyValue(Value));
+			const float Actual = Reader.Get<float>(Row, Read);
+			return Actual == Expected || (FMath::IsNaN(Actual) && FMath::IsNaN(Expected));
+		}
+		case EFieldType::Double:
+		{
+			const double Expected = Numeric->GetFloatingPointPropertyValue(Value);
+			const double Actual = Reader.Get<double>(Row, Read);
+			return Actual == Expected || (FMath::IsNaN(Actual) && FMath::IsNaN(Expected));
+		}
+		case EFieldType::Int8:   return Reader.Get<int8_t>(Row, Read) == Numeric->GetSignedIntPropertyValue(Value);
+		case EFieldType::Int16:  return Reader.Get<int16_t>(Row, Read) == Numeric->GetSignedIntPropertyValue(Value);
+		case EFieldType::Int32:  return Reader.Get<int32_t>(Row, Read) == Numeric->GetSignedIntPropertyValue(Value);
+		case EFieldType::Int64:  return Reader.Get<int64_t>(Row, Read) == Numeric->GetSignedIntPropertyValue(Value);
+		case EFieldType::UInt8:  return Reader.Get<uint8_t>(Row, Read) == Numeric->GetUnsignedIntPropertyValue(Value);
+		case EFieldType::UInt16: return Reader.Get<uint16_t>(Row, Read) == Numeric->GetUnsignedIntPropertyValue(Value);
+		case EFieldType::UInt32: return Reader.Get<uint32_t>(Row, Read) == Numeric->GetUnsignedIntPropertyValue(Value);
+		case EFieldType::UInt64: return Reader.Get<uint64_t>(Row, Read) == Numeric->GetUnsignedIntPropertyValue(Value);
+		default:                 return false;
+		}
+	}
+
+	/** FString keys compare case-insensitively by default; pooled strings must keep their exact bytes. */
+	struct FStringPoolKeyFuncs : BaseKeyFuncs<TPair<FString, FStringRef>, FString, /*bInAllowDuplicateKeys*/false>
+	{
+		static const FString& GetSetKey(const TPair<FString, FStringRef>& Element) { return Element.Key; }
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	/** Deduplicated UTF-8 string pool. */
+	struct FStringPool
+	{
+		TArray<uint8> Bytes;
+		TMap<FString, FStringRef, FDefaultSetAllocator, FStringPoolKeyFuncs> Refs;
+
+		FStringRef Add(const FString& String)
+		{
+			if (const FStringRef* Existing = Refs.Find(String))
+			{
+				return *Existing;
+			}
+			const FTCHARToUTF8 Utf8(*String, String.Len());
+			const FStringRef Ref{ static_cast<uint32>(Bytes.Num()), static_cast<uint32>(Utf8.Length()) };
+			Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+			Refs.Add(String, Ref);
+			return Ref;
+		}
+	};
+
+	void PlanFields(const UScriptStruct& RowStruct, TArray<FFieldPlan>& OutFields, uint32& OutStride)
+	{
+		uint32 Offset = 0;
+		for (TFieldIterator<FProperty> It(&RowStruct); It; ++It)
+		{
+			EFieldType Type;
+			if (!GetFieldType(*It, Type))
+			{
+				UE_LOG(LogTemp, Display, TEXT("Tag table export: field %s of %s is not a plain value and is skipped"), *It->GetName(), *RowStruct.GetName());
+				continue;
+			}
+			Offset = Align(Offset, FieldAlignment(Type));
+			OutFields.Add({ *It, Type, Offset });
+			Offset += FieldSize(Type);
+		}
+		OutStride = Align(FMath::Max(Offset, 1u), 8u);
+	}
+
+	template <typename T>
+	uint64 Place(TArray<uint8>& Blob, const T* Data, int32 Num)
+	{
+		const int32 Offset = Align(Blob.Num(), 8);
+		Blob.SetNumZeroed(Offset);
+		Blob.Append(reinterpret_cast<const uint8*>(Data), Num * sizeof(T));
+		return Offset;
+	}
+
+	std::string_view ToUtf8View(const FTCHARToUTF8& Utf8)
+	{
+		return std::string_view(Utf8.Get(), Utf8.Length());
+	}
+
+	void ExportCommand(const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogTemp, Display, TEXT("Usage: TagGen.ExportBlob <TablePath> [OutFile]"));
+			return;
+		}
+
+		const UDataTable* Table = LoadObject<UDataTable>(nullptr, *Args[0]);
+		if (!Table)
+		{
+			UE_LOG(LogTemp, Error, TEXT("TagGen.ExportBlob: cannot load %s"), *Args[0]);
+			return;
+		}
+
+		FString Error;
+		if (Args.Num() > 1)
+		{
+			if (FTagTableBlobExporter::ExportToFile(*Table, Args[1], Error))
+			{
+				UE_LOG(LogTemp, Display, TEXT("TagGen.ExportBlob: %s exported to %s and verified"), *Table->GetName(), *Args[1]);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Error, TEXT("TagGen.ExportBlob: %s"), *Error);
+			}
+			return;
+		}
+
+		// No output file: round-trip check only
+		TArray<uint8> Blob;
+		if (FTagTableBlobExporter::Export(*Table, Blob, Error) && FTagTableBlobExporter::Verify(*Table, Blob, Error))
+		{
+			UE_LOG(LogTemp, Display, TEXT("TagGen.ExportBlob: %s round-trips, %d rows in %d bytes"), *Table->GetName(), Table->GetRowMap().Num(), Blob.Num());
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("TagGen.ExportBlob: %s"), *Error);
+		}
+	}
+
+	static FAutoConsoleCommand ExportBlobCommand(
+		TEXT("TagGen.ExportBlob"),
+		TEXT("Exports a tag-keyed data table to a memory-mappable blob and verifies it by reading every row back. Usage: TagGen.ExportBlob <TablePath> [OutFile]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&ExportCommand));
+}
+
+bool FTagTableBlobExporter::Export(const UDataTable& Table, TArray<uint8>& OutBlob, FString& OutError)
+{
+	using namespace TagTableBlobExport;
+
+	OutBlob.Reset();
+	const UScriptStruct* RowStruct = Table.GetRowStruct();
+	if (!RowStruct)
+	{
+		OutError = FString::Printf(TEXT("%s has no row struct"), *Table.GetName());
+		return false;
+	}
+
+	TArray<FFieldPlan> Fields;
+	uint32 RowStride = 0;
+	PlanFields(*RowStruct, Fields, RowStride);
+
+	const TMap<FName, uint8*>& RowMap = Table.GetRowMap();
+	TArray<uint64> Hashes;
+	Hashes.Reserve(RowMap.Num());
+	for (const TPair<FName, uint8*>& Pair : RowMap)
+	{
+		Hashes.Add(FTagPerfectHash::HashTag(Pair.Key));
+	}
+
+	FTagPerfectHash PerfectHash;
+	if (!PerfectHash.Build(Hashes))
+	{
+		OutError = FString::Printf(TEXT("Cannot build the perfect hash of %s"), *Table.GetName());
+		return false;
+	}
+
+	FStringPool Strings;
+	FHeader Header;
+	FMemory::Memzero(Header);
+	FMemory::Memcpy(Header.Magic, Magic, sizeof(Magic));
+	Header.Version = Version;
+	Header.NumRows = RowMap.Num();
+	Header.NumBuckets = PerfectHash.Seeds.Num();
+	Header.NumFields = Fields.Num();
+	Header.RowStride = RowStride;
+	Header.RowStruct = Strings.Add(RowStruct->GetPathName());
+
+	TArray<FField> OutFields;
+	for (const FFieldPlan& Field : Fields)
+	{
+		OutFields.Add({ Strings.Add(Field.Property->GetAuthoredName()), Field.Type, Field.Offset });
+	}
+
+	// Keys and rows go to the slot of their tag
+	TArray<FKey> Keys;
+	Keys.SetNumZeroed(RowMap.Num());
+	TArray<uint8> Rows;
+	Rows.SetNumZeroed(RowMap.Num() * static_cast<int32>(RowStride));
+	int32 KeyIndex = 0;
+	for (const TPair<FName, uint8*>& Pair : RowMap)
+	{
+		const uint32 Slot = PerfectHash.SlotOf(Hashes[KeyIndex++]);
+		Keys[Slot] = Strings.Add(Pair.Key.ToString());
+
+		uint8* Row = Rows.GetData() + Slot * RowStride;
+		for (const FFieldPlan& Field : Fields)
+		{
+			const void* Value = Field.Property->ContainerPtrToValuePtr<void>(Pair.Value);
+			if (Field.Type == EFieldType::String)
+			{
+				const FStringRef Ref = Strings.Add(GetStringValue(Field.Property, Value));
+				FMemory::Memcpy(Row + Field.Offset, &Ref, sizeof(Ref));
+			}
+			else
+			{
+				EncodeScalar(Field, Value, Row + Field.Offset);
+			}
+		}
+	}
+
+	OutBlob.SetNumZeroed(sizeof(FHeader));
+	Header.FieldsOffset = Place(OutBlob, OutFields.GetData(), OutFields.Num());
+	Header.SeedsOffset = Place(OutBlob, PerfectHash.Seeds.GetData(), PerfectHash.Seeds.Num());
+	Header.KeysOffset = Place(OutBlob, Keys.GetData(), Keys.Num());
+	Header.RowsOffset = Place(OutBlob, Rows.GetData(), Rows.Num());
+	Header.StringsOffset = Place(OutBlob, Strings.Bytes.GetData(), Strings.Bytes.Num());
+	Header.StringsSize = Strings.Bytes.Num();
+	OutBlob.SetNumZeroed(Align(OutBlob.Num(), 8));
+	Header.TotalSize = OutBlob.Num();
+	FMemory::Memcpy(OutBlob.GetData(), &Header, sizeof(Header));
+	return true;
+}
+
+bool FTagTableBlobExporter::Verify(const UDataTable& Table, TConstArrayView<uint8> Blob, FString& OutError)
+{
+	using namespace TagTableBlobExport;
+
+	FReader Reader;
+	if (!Reader.Open(Blob.GetData(), Blob.Num()))
+	{
+		OutError = TEXT("The blob header or sections are invalid");
+		return false;
+	}
+
+	const UScriptStruct* RowStruct = Table.GetRowStruct();
+	if (!RowStruct)
+	{
+		OutError = FString::Printf(TEXT("%s has no row struct"), *Table.GetName());
+		return false;
+	}
+
+	TArray<FFieldPlan> Fields;
+	uint32 RowStride = 0;
+	PlanFields(*RowStruct, Fields, RowStride);
+	if (Reader.NumRows() != static_cast<uint32>(Table.GetRowMap().Num()) || Reader.NumFields() != static_cast<uint32>(Fields.Num()))
+	{
+		OutError = FString::Printf(TEXT("Expected %d rows and %d fields, read %u and %u"), Table.GetRowMap().Num(), Fields.Num(), Reader.NumRows(), Reader.NumFields());
+		return false;
+	}
+
+	for (const TPair<FName, uint8*>& Pair : Table.GetRowMap())
+	{
+		const FString RowName = Pair.Key.ToString();
+		const FTCHARToUTF8 Tag(*RowName, RowName.Len());
+		const uint8* Row = Reader.FindRow(ToUtf8View(Tag));
+		if (!Row)
+		{
+			OutError = FString::Printf(TEXT("Row %s is not found in the blob"), *RowName);
+			return false;
+		}
+
+		for (const FFieldPlan& Field : Fields)
+		{
+			const FField* Read = Reader.FindField(ToUtf8View(FTCHARToUTF8(*Field.Property->GetAuthoredName())));
+			if (!Read || Read->Type != Field.Type)
+			{
+				OutError = FString::Printf(TEXT("Field %s is missing or has another type"), *Field.Property->GetAuthoredName());
+				return false;
+			}
+
+			const void* Value = Field.Property->ContainerPtrToValuePtr<void>(Pair.Value);
+			bool bEqual;
+			if (Field.Type == EFieldType::String)
+			{
+				const FString String = GetStringValue(Field.Property, Value);
+				const FTCHARToUTF8 Utf8(*String, String.Len());
+				bEqual = Reader.GetString(Row, *Read) == ToUtf8View(Utf8);
+			}
+			else
+			{
+				// Typed read, so an encoder bug cannot cancel itself out
+				bEqual = ReadsBack(Reader, Row, *Read, Field, Value);
+			}
+			if (!bEqual)
+			{
+				OutError = FString::Printf(TEXT("Row %s, field %s does not round-trip"), *RowName, *Field.Property->GetAuthoredName());
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+bool FTagTableBlobExporter::ExportToFile(const UDataTable& Table, const FString& Path, FString& OutError)
+{
+	TArray<uint8> Blob;
+	if (!Export(Table, Blob, OutError) || !Verify(Table, Blob, OutError))
+	{
+		return false;
+	}
+	if (!FFileHelper::SaveArrayToFile(Blob, *Path))
+	{
+		OutError = FString::Printf(TEXT("Cannot write %s"), *Path);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,642 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "TagTableImporter.h"
+#include "Async/ParallelFor.h"
+#include "DataTableTagIndex.h"
+#include "DataTableUtils.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagContainer.h"
+#include "GameplayTagsManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/StructOnScope.h"
+
+namespace TagTableImport
+{
+	/** A CSV record: a line, or several when a quoted field spans line breaks. */
+	struct FRecord
+	{
+		int32 Line;
+		int32 Begin;
+		int32 End;
+	};
+
+	/** A row parsed off the game thread, waiting to be added to the table. */
+	struct FParsedRow
+	{
+		int32 Line = 0;
+		FName Name;
+
+		/** CSV values in column order, without the row name. */
+		TArray<FString> Cells;
+
+		/** JSON row object. */
+		TSharedPtr<FJsonObject> Object;
+
+		/** Row memory in the table once added; null for skipped rows. */
+		uint8* Memory = nullptr;
+	};
+
+	/** Issues collected by each parallel task, merged once all are done. */
+	struct FIssueBuckets
+	{
+		explicit FIssueBuckets(int32 NumBuckets)
+		{
+			Buckets.SetNum(NumBuckets);
+		}
+
+		void Add(int32 Bucket, int32 Line, FName RowName, FString Message)
+		{
+			Buckets[Bucket].Add({ Line, RowName, MoveTemp(Message) });
+		}
+
+		void MoveTo(TArray<FTagTableImportIssue>& OutIssues)
+		{
+			for (TArray<FTagTableImportIssue>& Bucket : Buckets)
+			{
+				OutIssues.Append(MoveTemp(Bucket));
+			}
+			Buckets.Reset();
+		}
+
+		TArray<TArray<FTagTableImportIssue>> Buckets;
+	};
+
+	int32 NumTasks(int32 NumRecords)
+	{
+		return FMath::DivideAndRoundUp(NumRecords, FTagTableImporter::RecordsPerTask);
+	}
+
+	/** Splits the text into records; quotes are only tracked here, fields are parsed in parallel afterwards. */
+	void SplitRecords(const FString& Text, TArray<FRecord>& OutRecords)
+	{
+		const TCHAR* Data = *Text;
+		const int32 Len = Text.Len();
+		int32 Line = 1;
+		int32 RecordLine = 1;
+		int32 Begin = 0;
+		bool bInQuotes = false;
+		for (int32 Index = 0; Index < Len; ++Index)
+		{
+			if (Data[Index] == TEXT('"'))
+			{
+				bInQuotes = !bInQuotes;
+			}
+			else if (Data[Index] == TEXT('\n'))
+			{
+				++Line;
+				if (!bInQuotes)
+				{
+					OutRecords.Add({ RecordLine, Begin, Index });
+					Begin = Index + 1;
+					RecordLine = Line;
+				}
+			}
+		}
+		if (Begin < Len)
+		{
+			OutRecords.Add({ RecordLine, Begin, Len });
+		}
+	}
+
+	/** Parses the comma-separated fields of a record, unquoting quoted fields and their "" escapes. */
+	void ParseFields(const TCHAR* Data, int32 Begin, int32 End, TArray<FString>& OutFields)
+	{
+		if (End > Begin && Data[End - 1] == TEXT('\r'))
+		{
+			--End;
+		}
+		if (Begin == End)
+		{
+			return;
+		}
+
+		int32 Index = Begin;
+		for (;;)
+		{
+			FString& Field = OutFields.AddDefaulted_GetRef();
+			if (Data[Index] == TEXT('"'))
+			{
+				++Index;
+				int32 Run = Index;
+				while (Index < End)
+				{
+					if (Data[Index] != TEXT('"'))
+					{
+						++Index;
+						continue;
+					}
+					Field.AppendChars(Data + Run, Index - Run);
+					if (Index + 1 < End && Data[Index + 1] == TEXT('"'))
+					{
+						Field.AppendChar(TEXT('"'));
+						Index += 2;
+						Run = Index;
+						continue;
+					}
+					++Index;
+					Run = INDEX_NONE;
+					break;
+				}
+				if (Run != INDEX_NONE)
+				{
+					// Unterminated quote: keep the rest
+					Field.AppendChars(Data + Run, Index - Run);
+				}
+				while (Index < End && Data[Index] != TEXT(','))
+				{
+					++Index;
+				}
+			}
+			else
+			{
+				const int32 Start = Index;
+				while (Index < End && Data[Index] != TEXT(','))
+				{
+					++Index;
+				}
+				Field.AppendChars(Data + Start, Index - Start);
+			}
+
+			if (Index >= End)
+			{
+				break;
+			}
+			// Skip the comma; a trailing one ends with an empty field
+			if (++Index == End)
+			{
+				OutFields.AddDefaulted();
+				break;
+			}
+		}
+	}
+
+	/** Object references may find or load objects while their text is imported, which only the game thread may do. */
+	bool IsThreadSafeImport(const FProperty* Property)
+	{
+		if (Property->IsA<FObjectPropertyBase>() || Property->IsA<FInterfaceProperty>()
+			|| Property->IsA<FDelegateProperty>() || Property->IsA<FMulticastDelegateProperty>())
+		{
+			return false;
+		}
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+			{
+				if (!IsThreadSafeImport(*It))
+				{
+					return false;
+				}
+			}
+		}
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			return IsThreadSafeImport(ArrayProperty->Inner);
+		}
+		if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			return IsThreadSafeImport(SetProperty->ElementProp);
+		}
+		if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			return IsThreadSafeImport(MapProperty->KeyProp) && IsThreadSafeImport(MapProperty->ValueProp);
+		}
+		return true;
+	}
+
+	/** Registered gameplay tags, gathered once so keys can be validated from any thread. */
+	void GatherRegisteredTags(TSet<FName>& OutTags)
+	{
+		FGameplayTagContainer AllTags;
+		UGameplayTagsManager::Get().RequestAllGameplayTags(AllTags, false);
+		OutTags.Reserve(AllTags.Num());
+		for (const FGameplayTag& Tag : AllTags)
+		{
+			OutTags.Add(Tag.GetTagName());
+		}
+	}
+
+	/** Validates a row key; counts and reports it if it is not a registered tag. */
+	bool ValidateKey(const TSet<FName>& RegisteredTags, FIssueBuckets& Issues, int32 Bucket, FParsedRow& Row, std::atomic<int32>& NumInvalidTags)
+	{
+		if (Row.Name.IsNone())
+		{
+			Issues.Add(Bucket, Row.Line, NAME_None, TEXT("Row has no name and is skipped"));
+			return false;
+		}
+		if (!RegisteredTags.Contains(Row.Name))
+		{
+			++NumInvalidTags;
+			Issues.Add(Bucket, Row.Line, Row.Name, TEXT("Row name is not a registered gameplay tag"));
+		}
+		return true;
+	}
+
+	/**
+	 * Replaces the rows of the table with default rows for every parsed one, reporting duplicates. Adding rows
+	 * touches the table's map and runs on the game thread; their values are assigned afterwards, in place.
+	 */
+	void AddRows(UDataTable& Table, TArray<FParsedRow>& Rows, TArray<FTagTableImportIssue>& OutIssues)
+	{
+		const UScriptStruct& RowStruct = *Table.GetRowStruct();
+		FStructOnScope DefaultRow(&RowStruct);
+
+		Table.Modify();
+		Table.EmptyTable();
+
+		TSet<FName> Seen;
+		Seen.Reserve(Rows.Num());
+		for (FParsedRow& Row : Rows)
+		{
+			if (Row.Name.IsNone())
+			{
+				continue;
+			}
+			bool bAlreadySeen = false;
+			Seen.Add(Row.Name, &bAlreadySeen);
+			if (bAlreadySeen)
+			{
+				OutIssues.Add({ Row.Line, Row.Name, TEXT("Duplicate row name; the first row is kept") });
+				Row.Name = NAME_None;
+				continue;
+			}
+			Table.AddRow(Row.Name, *reinterpret_cast<const FTableRowBase*>(DefaultRow.GetStructMemory()));
+		}
+
+		// Row memory is allocated per row, so pointers stay valid while the map grows
+		for (FParsedRow& Row : Rows)
+		{
+			if (!Row.Name.IsNone())
+			{
+				Row.Memory = Table.FindRowUnchecked(Row.Name);
+			}
+		}
+	}
+
+	/** Runs Assign over every added row, in parallel if the row struct allows it. */
+	template <typename AssignType>
+	void AssignRows(const UDataTable& Table, TArray<FParsedRow>& Rows, FTagTableImportResult& OutResult, AssignType Assign)
+	{
+		const double Start = FPlatformTime::Seconds();
+		OutResult.bParallelAssign = FTagTableImporter::CanAssignInParallel(*Table.GetRowStruct());
+
+		FIssueBuckets Issues(NumTasks(Rows.Num()));
+		ParallelFor(Issues.Buckets.Num(), [&](int32 Task)
+		{
+			const int32 First = Task * FTagTableImporter::RecordsPerTask;
+			const int32 Last = FMath::Min(First + FTagTableImporter::RecordsPerTask, Rows.Num());
+			for (int32 Index = First; Index < Last; ++Index)
+			{
+				if (Rows[Index].Memory)
+				{
+					Assign(Rows[Index], Issues, Task);
+				}
+			}
+		}, OutResult.bParallelAssign ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+		Issues.MoveTo(OutResult.Issues);
+
+		OutResult.AssignSeconds = FPlatformTime::Seconds() - Start;
+	}
+
+	/** Post-import callbacks, change notification, and the index of the new rows. */
+	void Finish(UDataTable& Table, const TArray<FParsedRow>& Rows, FTagTableImportResult& OutResult)
+	{
+		if (Table.GetRowStruct()->IsChildOf(FTableRowBase::StaticStruct()))
+		{
+			TArray<FString> Problems;
+			for (const FParsedRow& Row : Rows)
+			{
+				if (!Row.Memory)
+				{
+					continue;
+				}
+				reinterpret_cast<FTableRowBase*>(Row.Memory)->OnPostDataImport(&Table, Row.Name, Problems);
+				for (FString& Problem : Problems)
+				{
+					OutResult.Issues.Add({ Row.Line, Row.Name, MoveTemp(Problem) });
+				}
+				Problems.Reset();
+			}
+		}
+
+		Table.HandleDataTableChanged();
+		Table.MarkPackageDirty();
+
+		// The change invalidated the shared index; rebuild it now rather than on the first lookup
+		const TSharedRef<const FDataTableTagIndex> Index = FDataTableTagIndex::Get(Table);
+		OutResult.NumRows = Index->Num();
+		OutResult.Checksum = Index->GetChecksum();
+
+		OutResult.Issues.StableSort([](const FTagTableImportIssue& A, const FTagTableImportIssue& B) { return A.Line < B.Line; });
+	}
+
+	void ImportCommand(const TArray<FString>& Args)
+	{
+		if (Args.Num() < 2)
+		{
+			UE_LOG(LogTemp, Display, TEXT("Usage: TagGen.ImportTable <TablePath> <File.csv|File.json>"));
+			return;
+		}
+
+		UDataTable* Table = LoadObject<UDataTable>(nullptr, *Args[0]);
+		if (!Table)
+		{
+			UE_LOG(LogTemp, Error, TEXT("TagGen.ImportTable: cannot load %s"), *Args[0]);
+			return;
+		}
+
+		FTagTableImportResult Result;
+		const bool bImported = FTagTableImporter::ImportFile(*Table, Args[1], Result);
+		UE_LOG(LogTemp, Display, TEXT("TagGen.ImportTable %s:\n%s"), *Table->GetName(), *Result.MakeReport());
+		UE_CLOG(!bImported, LogTemp, Error, TEXT("TagGen.ImportTable: %s was not imported"), *Args[1]);
+	}
+
+	/** Imports a synthetic CSV with the engine's importer and with this one. */
+	void BenchmarkCommand(const TArray<FString>& Args)
+	{
+		const int32 NumRows = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 80000;
+
+		TStringBuilder<256> Row;
+		FString Csv = TEXT("---,Tag,DevComment\n");
+		Csv.Reserve(NumRows * 64);
+		for (int32 Index = 0; Index < NumRows; ++Index)
+		{
+			Row.Reset();
+			Row.Appendf(TEXT("Benchmark.Import.Row%d,Benchmark.Import.Row%d,\"Row %d, \"\"quoted\"\"\"\n"), Index, Index, Index);
+			Csv.Append(Row.ToView());
+		}
+
+		UDataTable* EngineTable = NewObject<UDataTable>(GetTransientPackage());
+		EngineTable->RowStruct = FGameplayTagTableRow::StaticStruct();
+		double Start = FPlatformTime::Seconds();
+		const TArray<FString> EngineProblems = EngineTable->CreateTableFromCSVString(Csv);
+		const double EngineSeconds = FPlatformTime::Seconds() - Start;
+
+		UDataTable* Table = NewObject<UDataTable>(GetTransientPackage());
+		Table->RowStruct = FGameplayTagTableRow::StaticStruct();
+		FTagTableImportResult Result;
+		Start = FPlatformTime::Seconds();
+		FTagTableImporter::ImportCsv(*Table, Csv, Result);
+		const double Seconds = FPlatformTime::Seconds() - Start;
+
+		UE_LOG(LogTemp, Display, TEXT("TagGen.BenchmarkImport: %d rows, %d KiB of CSV"), NumRows, Csv.Len() * sizeof(TCHAR) / 1024);
+		UE_LOG(LogTemp, Display, TEXT("  Engine importer: %.1f ms, %d rows, %d problems"), EngineSeconds * 1000.0, EngineTable->GetRowMap().Num(), EngineProblems.Num());
+		UE_LOG(LogTemp, Display, TEXT("  Tag importer:    %.1f ms (parse %.1f, assign %.1f%s), %d rows, %d issues, %d keys not registered as tags"),
+			Seconds * 1000.0, Result.ParseSeconds * 1000.0, Result.AssignSeconds * 1000.0, Result.bParallelAssign ? TEXT(", parallel") : TEXT(""),
+			Result.NumRows, Result.Issues.Num(), Result.NumInvalidTags);
+
+		EngineTable->MarkAsGarbage();
+		Table->MarkAsGarbage();
+	}
+
+	static FAutoConsoleCommand ImportTableCommand(
+		TEXT("TagGen.ImportTable"),
+		TEXT("Imports a CSV or JSON file into a tag-keyed data table in parallel and reports every invalid tag and value. Usage: TagGen.ImportTable <TablePath> <File>"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&ImportCommand));
+
+	static FAutoConsoleCommand BenchmarkImportCommand(
+		TEXT("TagGen.BenchmarkImport"),
+		TEXT("Compares the engine's CSV importer with the parallel tag table importer on a synthetic table. Usage: TagGen.BenchmarkImport [Rows=80000]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkCommand));
+}
+
+FString FTagTableImportResult::MakeReport(int32 MaxIssues) const
+{
+	TStringBuilder<4096> Report;
+	for (int32 Index = 0; Index < FMath::Min(Issues.Num(), MaxIssues); ++Index)
+	{
+		const FTagTableImportIssue& Issue = Issues[Index];
+		Report.Appendf(TEXT("  %d: %s%s%s\n"), Issue.Line, Issue.RowName.IsNone() ? TEXT("") : *Issue.RowName.ToString(), Issue.RowName.IsNone() ? TEXT("") : TEXT(": "), *Issue.Message);
+	}
+	if (Issues.Num() > MaxIssues)
+	{
+		Report.Appendf(TEXT("  ... %d more\n"), Issues.Num() - MaxIssues);
+	}
+	Report.Appendf(TEXT("%d rows imported, %d issues, %d row names not registered as gameplay tags"), NumRows, Issues.Num(), NumInvalidTags);
+	return Report.ToString();
+}
+
+bool FTagTableImporter::ImportCsv(UDataTable& Table, const FString& Csv, FTagTableImportResult& OutResult)
+{
+	using namespace TagTableImport;
+	check(IsInGameThread());
+
+	OutResult = FTagTableImportResult();
+	const UScriptStruct* RowStruct = Table.GetRowStruct();
+	if (!RowStruct)
+	{
+		OutResult.Issues.Add({ 0, NAME_None, TEXT("The table has no row struct") });
+		return false;
+	}
+
+	const double Start = FPlatformTime::Seconds();
+	TArray<FRecord> Records;
+	SplitRecords(Csv, Records);
+	if (Records.Num() == 0)
+	{
+		OutResult.Issues.Add({ 0, NAME_None, TEXT("The file is empty") });
+		return false;
+	}
+
+	// Columns after the row name, matched to properties the way the engine importer does
+	TArray<FString> Header;
+	ParseFields(*Csv, Records[0].Begin, Records[0].End, Header);
+	if (Header.Num() == 0)
+	{
+		OutResult.Issues.Add({ Records[0].Line, NAME_None, TEXT("The header row is empty") });
+		return false;
+	}
+	TArray<const FProperty*> Columns;
+	TSet<const FProperty*> Imported;
+	TArray<FString> ImportNames;
+	for (int32 Column = 1; Column < Header.Num(); ++Column)
+	{
+		const FProperty* Match = nullptr;
+		for (TFieldIterator<FProperty> It(RowStruct); It && !Match; ++It)
+		{
+			ImportNames.Reset();
+			DataTableUtils::GetPropertyImportNames(*It, ImportNames);
+			if (ImportNames.ContainsByPredicate([&](const FString& Name) { return Name.Equals(Header[Column], ESearchCase::IgnoreCase); }))
+			{
+				Match = *It;
+			}
+		}
+		if (!Match)
+		{
+			OutResult.Issues.Add({ Records[0].Line, NAME_None, FString::Printf(TEXT("Column '%s' matches no property of %s and is ignored"), *Header[Column], *RowStruct->GetName()) });
+		}
+		Columns.Add(Match);
+		Imported.Add(Match);
+	}
+	for (TFieldIterator<FProperty> It(RowStruct); It; ++It)
+	{
+		if (!Imported.Contains(*It))
+		{
+			OutResult.Issues.Add({ Records[0].Line, NAME_None, FString::Printf(TEXT("Property '%s' has no column and keeps its default"), *It->GetName()) });
+		}
+	}
+
+	TSet<FName> RegisteredTags;
+	GatherRegisteredTags(RegisteredTags);
+
+	// Parse and validate every record but the header
+	TArray<FParsedRow> Rows;
+	Rows.SetNum(Records.Num() - 1);
+	std::atomic<int32> NumInvalidTags = 0;
+	FIssueBuckets ParseIssues(NumTasks(Rows.Num()));
+	ParallelFor(ParseIssues.Buckets.Num(), [&](int32 Task)
+	{
+		const int32 First = Task * RecordsPerTask;
+		const int32 Last = FMath::Min(First + RecordsPerTask, Rows.Num());
+		TArray<FString> Fields;
+		for (int32 Index = First; Index < Last; ++Index)
+		{
+			const FRecord& Record = Records[Index + 1];
+			FParsedRow& Row = Rows[Index];
+			Row.Line = Record.Line;
+
+			Fields.Reset();
+			ParseFields(*Csv, Record.Begin, Record.End, Fields);
+			if (Fields.Num() == 0)
+			{
+				// Blank line
+				continue;
+			}
+
+			Row.Name = FName(*Fields[0].TrimStartAndEnd());
+			if (!ValidateKey(RegisteredTags, ParseIssues, Task, Row, NumInvalidTags))
+			{
+				continue;
+			}
+			if (Fields.Num() != Header.Num())
+			{
+				ParseIssues.Add(Task, Row.Line, Row.Name, FString::Printf(TEXT("Expected %d values, found %d"), Header.Num(), Fields.Num()));
+			}
+			Fields.RemoveAt(0, 1, false);
+			Row.Cells = MoveTemp(Fields);
+		}
+	});
+	ParseIssues.MoveTo(OutResult.Issues);
+	OutResult.NumInvalidTags = NumInvalidTags;
+	OutResult.ParseSeconds = FPlatformTime::Seconds() - Start;
+
+	AddRows(Table, Rows, OutResult.Issues);
+	AssignRows(Table, Rows, OutResult, [&Columns](FParsedRow& Row, FIssueBuckets& Issues, int32 Task)
+	{
+		for (int32 Column = 0; Column < FMath::Min(Columns.Num(), Row.Cells.Num()); ++Column)
+		{
+			if (!Columns[Column])
+			{
+				continue;
+			}
+			FString Error = DataTableUtils::AssignStringToProperty(Row.Cells[Column], Columns[Column], Row.Memory);
+			if (!Error.IsEmpty())
+			{
+				Issues.Add(Task, Row.Line, Row.Name, FString::Printf(TEXT("%s: %s"), *Columns[Column]->GetName(), *Error));
+			}
+		}
+	});
+	Finish(Table, Rows, OutResult);
+	return true;
+}
+
+bool FTagTableImporter::ImportJson(UDataTable& Table, const FString& Json, FTagTableImportResult& OutResult)
+{
+	using namespace TagTableImport;
+	check(IsInGameThread());
+
+	OutResult = FTagTableImportResult();
+	const UScriptStruct* RowStruct = Table.GetRowStruct();
+	if (!RowStruct)
+	{
+		OutResult.Issues.Add({ 0, NAME_None, TEXT("The table has no row struct") });
+		return false;
+	}
+
+	// The document is parsed in one go; rows are validated and converted in parallel
+	const double Start = FPlatformTime::Seconds();
+	TArray<TSharedPtr<FJsonValue>> Values;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	if (!FJsonSerializer::Deserialize(Reader, Values))
+	{
+		OutResult.Issues.Add({ 0, NAME_None, FString::Printf(TEXT("Invalid JSON: %s"), *Reader->GetErrorMessage()) });
+		return false;
+	}
+
+	TSet<FName> RegisteredTags;
+	GatherRegisteredTags(RegisteredTags);
+
+	TArray<FParsedRow> Rows;
+	Rows.SetNum(Values.Num());
+	std::atomic<int32> NumInvalidTags = 0;
+	FIssueBuckets ParseIssues(NumTasks(Rows.Num()));
+	ParallelFor(ParseIssues.Buckets.Num(), [&](int32 Task)
+	{
+		const int32 First = Task * RecordsPerTask;
+		const int32 Last = FMath::Min(First + RecordsPerTask, Rows.Num());
+		for (int32 Index = First; Index < Last; ++Index)
+		{
+			FParsedRow& Row = Rows[Index];
+			Row.Line = Index + 1;
+			Row.Object = Values[Index].IsValid() ? Values[Index]->AsObject() : nullptr;
+			if (!Row.Object.IsValid())
+			{
+				ParseIssues.Add(Task, Row.Line, NAME_None, TEXT("Row is not a JSON object and is skipped"));
+				continue;
+			}
+
+			FString Name;
+			Row.Object->TryGetStringField(TEXT("Name"), Name);
+			Row.Name = FName(*Name);
+			ValidateKey(RegisteredTags, ParseIssues, Task, Row, NumInvalidTags);
+		}
+	});
+	ParseIssues.MoveTo(OutResult.Issues);
+	OutResult.NumInvalidTags = NumInvalidTags;
+	OutResult.ParseSeconds = FPlatformTime::Seconds() - Start;
+
+	AddRows(Table, Rows, OutResult.Issues);
+	AssignRows(Table, Rows, OutResult, [RowStruct](FParsedRow& Row, FIssueBuckets& Issues, int32 Task)
+	{
+		if (!FJsonObjectConverter::JsonObjectToUStruct(Row.Object.ToSharedRef(), RowStruct, Row.Memory))
+		{
+			Issues.Add(Task, Row.Line, Row.Name, TEXT("Some values could not be converted"));
+		}
+	});
+	Finish(Table, Rows, OutResult);
+	return true;
+}
+
+bool FTagTableImporter::ImportFile(UDataTable& Table, const FString& Path, FTagTableImportResult& OutResult)
+{
+	FString Text;
+	if (!FFileHelper::LoadFileToString(Text, *Path))
+	{
+		OutResult = FTagTableImportResult();
+		OutResult.Issues.Add({ 0, NAME_None, FString::Printf(TEXT("Cannot read %s"), *Path) });
+		return false;
+	}
+
+	if (FPaths::GetExtension(Path).Equals(TEXT("json"), ESearchCase::IgnoreCase))
+	{
+		return ImportJson(Table, Text, OutResult);
+	}
+	return ImportCsv(Table, Text, OutResult);
+}
+
+bool FTagTableImporter::CanAssignInParallel(const UScriptStruct& Struct)
+{
+	for (TFieldIterator<FProperty> It(&Struct); It; ++It)
+	{
+		if (!TagTableImport::IsThreadSafeImport(*It))
+		{
+			return false;
+		}
+	}
+	return true;
+}
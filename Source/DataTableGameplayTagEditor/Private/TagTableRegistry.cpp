@@ -0,0 +1,171 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#include "TagTableRegistry.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "DataTableTagAssetTags.h"
+#include "Engine/DataTable.h"
+#include "HAL/IConsoleManager.h"
+
+namespace TagTableRegistry
+{
+	TUniquePtr<FTagTableRegistry>& Instance()
+	{
+		static TUniquePtr<FTagTableRegistry> Registry;
+		return Registry;
+	}
+
+	void FindCommand(const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogTemp, Display, TEXT("Usage: TagGen.FindTablesWithRow <Tag>"));
+			return;
+		}
+
+		TArray<FSoftObjectPath> Tables;
+		FTagTableRegistry::Get().FindTablesWithRow(FName(*Args[0]), Tables);
+		UE_LOG(LogTemp, Display, TEXT("TagGen.FindTablesWithRow %s: %d of %d tag-keyed tables"), *Args[0], Tables.Num(), FTagTableRegistry::Get().NumTables());
+		for (const FSoftObjectPath& Table : Tables)
+		{
+			UE_LOG(LogTemp, Display, TEXT("  %s"), *Table.ToString());
+		}
+	}
+
+	static FAutoConsoleCommand FindTablesCommand(
+		TEXT("TagGen.FindTablesWithRow"),
+		TEXT("Lists the tag-keyed data tables with a row for a tag, from the asset registry without loading them. Usage: TagGen.FindTablesWithRow <Tag>"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&FindCommand));
+}
+
+FTagTableRegistry& FTagTableRegistry::Get()
+{
+	TUniquePtr<FTagTableRegistry>& Registry = TagTableRegistry::Instance();
+	if (!Registry.IsValid())
+	{
+		Registry.Reset(new FTagTableRegistry());
+	}
+	return *Registry;
+}
+
+void FTagTableRegistry::Shutdown()
+{
+	TagTableRegistry::Instance().Reset();
+}
+
+FTagTableRegistry::~FTagTableRegistry()
+{
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetAdded().Remove(AddedHandle);
+		AssetRegistry->OnAssetUpdated().Remove(UpdatedHandle);
+		AssetRegistry->OnAssetRemoved().Remove(RemovedHandle);
+		AssetRegistry->OnAssetRenamed().Remove(RenamedHandle);
+	}
+}
+
+void FTagTableRegistry::FindTablesWithRow(FName RowName, TArray<FSoftObjectPath>& OutTables)
+{
+	Build();
+	TablesByRow.MultiFind(RowName, OutTables);
+}
+
+bool FTagTableRegistry::GetRowNames(const FSoftObjectPath& Table, TArray<FName>& OutRowNames)
+{
+	Build();
+	if (const TArray<FName>* RowNames = RowsByTable.Find(Table))
+	{
+		OutRowNames.Append(*RowNames);
+		return true;
+	}
+	return false;
+}
+
+TOptional<bool> FTagTableRegistry::HasRow(const FSoftObjectPath& Table, FName RowName)
+{
+	// A loaded table may have unsaved edits
+	if (const UDataTable* Loaded = Cast<UDataTable>(Table.ResolveObject()))
+	{
+		return Loaded->GetRowMap().Contains(RowName);
+	}
+
+	Build();
+	if (const TArray<FName>* RowNames = RowsByTable.Find(Table))
+	{
+		return RowNames->Contains(RowName);
+	}
+	return {};
+}
+
+int32 FTagTableRegistry::NumTables()
+{
+	Build();
+	return RowsByTable.Num();
+}
+
+void FTagTableRegistry::Build()
+{
+	if (bBuilt)
+	{
+		return;
+	}
+	bBuilt = true;
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	// Assets still being discovered arrive through OnAssetAdded
+	AddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FTagTableRegistry::AddAsset);
+	UpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FTagTableRegistry::AddAsset);
+	RemovedHandle = AssetRegistry.OnAssetRemoved().AddLambda([this](const FAssetData& Asset) { RemoveTable(Asset.GetSoftObjectPath()); });
+	RenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FTagTableRegistry::OnAssetRenamed);
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UDataTable::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.TagsAndValues.Add(FDataTableTagAssetTags::TagKeyed, FString(TEXT("True")));
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+	for (const FAssetData& Asset : Assets)
+	{
+		AddAsset(Asset);
+	}
+}
+
+void FTagTableRegistry::AddAsset(const FAssetData& Asset)
+{
+	if (!Asset.IsInstanceOf(UDataTable::StaticClass()))
+	{
+		return;
+	}
+
+	const FSoftObjectPath Table = Asset.GetSoftObjectPath();
+	RemoveTable(Table);
+
+	TArray<FName> RowNames;
+	if (FDataTableTagAssetTags::GetRowNames(Asset, RowNames))
+	{
+		for (const FName RowName : RowNames)
+		{
+			TablesByRow.Add(RowName, Table);
+		}
+		RowsByTable.Add(Table, MoveTemp(RowNames));
+	}
+}
+
+void FTagTableRegistry::RemoveTable(const FSoftObjectPath& Table)
+{
+	TArray<FName> RowNames;
+	if (RowsByTable.RemoveAndCopyValue(Table, RowNames))
+	{
+		for (const FName RowName : RowNames)
+		{
+			TablesByRow.RemoveSingle(RowName, Table);
+		}
+	}
+}
+
+void FTagTableRegistry::OnAssetRenamed(const FAssetData& Asset, const FString& OldObjectPath)
+{
+	RemoveTable(FSoftObjectPath(OldObjectPath));
+	AddAsset(Asset);
+}
@@ -3,12 +3,25 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 
+class FNativeTagAutoRegenerator;
+struct FNativeTagGenEntry;
+
 class FDataTableGameplayTagEditorModule : public IModuleInterface
 {
 public:
     virtual void StartupModule() override;
     virtual void ShutdownModule() override;
 
+    static FDataTableGameplayTagEditorModule& Get()
+    {
+        return FModuleManager::LoadModuleChecked<FDataTableGameplayTagEditorModule>("DataTableGameplayTagEditor");
+    }
+
+    /** Remembers the generator settings of a table so it is regenerated whenever it is saved. */
+    void RememberSettings(const FNativeTagGenEntry& Entry);
+
 private:
     void RegisterMenus();
+
+    TSharedPtr<FNativeTagAutoRegenerator> AutoRegenerator;
 };
@@ -0,0 +1,115 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataTable.h"
+#include "Engine/DeveloperSettings.h"
+
+#include "DataTableGameplayTagEditorSettings.generated.h"
+
+/** How the generated tags are split across files. */
+UENUM()
+enum class ETagGenSharding : uint8
+{
+	/** One header and one source for the whole table. */
+	None,
+
+	/** One header/source pair per root tag (Ability.*, Item.*, ...). */
+	ByRoot,
+
+	/** One header/source pair per block of TagsPerShard tags. */
+	ByCount,
+};
+
+/** How the generated source registers its tags with the tag manager. */
+UENUM()
+enum class ETagGenRegistration : uint8
+{
+	/** One UE_DEFINE_GAMEPLAY_TAG static object per tag. */
+	PerTagObjects,
+
+	/** One constexpr array of tag strings registered in a single pass, with inline accessors. */
+	BulkTable,
+};
+
+/** One table the native gameplay tag generator keeps up to date. */
+USTRUCT()
+struct FNativeTagGenEntry
+{
+	GENERATED_BODY()
+
+	/** Gameplay tag table, or any table whose row names are gameplay tags. */
+	UPROPERTY(EditAnywhere, Category = "Generator")
+	TSoftObjectPtr<UDataTable> Table;
+
+	/** Name of the C++ module receiving the files. */
+	UPROPERTY(EditAnywhere, Category = "Generator")
+	FString Module;
+
+	/** Optional sub-folder below Public/Private. */
+	UPROPERTY(EditAnywhere, Category = "Generator")
+	FString RelPath;
+
+	/** Namespace wrapping the generated tags. */
+	UPROPERTY(EditAnywhere, Category = "Generator")
+	FString Namespace;
+
+	/** File name without extension. */
+	UPROPERTY(EditAnywhere, Category = "Generator")
+	FString FileStem;
+
+	/** Splits the output into per-shard files behind an umbrella header. */
+	UPROPERTY(EditAnywhere, Category = "Generator")
+	ETagGenSharding Sharding = ETagGenSharding::None;
+
+	/** Tags per shard when sharding by count. */
+	UPROPERTY(EditAnywhere, Category = "Generator", meta = (ClampMin = "1", EditCondition = "Sharding == ETagGenSharding::ByCount"))
+	int32 TagsPerShard = 1000;
+
+	/** How the generated source registers its tags. */
+	UPROPERTY(EditAnywhere, Category = "Generator")
+	ETagGenRegistration Registration = ETagGenRegistration::PerTagObjects;
+
+	/** Also writes <FileStem>Hierarchy.h with constexpr parent and subtree arrays for integer IsChildOf checks. */
+	UPROPERTY(EditAnywhere, Category = "Generator")
+	bool bEmitHierarchy = false;
+
+	/** Also writes <FileStem>Rows.h with a stable row index per tag, validated against the table at load. */
+	UPROPERTY(EditAnywhere, Category = "Generator")
+	bool bEmitRowIndex = false;
+
+	/** Also writes <FileStem>Data.h with every row baked into a constexpr array; row fields must be bools, numbers or enums. */
+	UPROPERTY(EditAnywhere, Category = "Generator")
+	bool bEmitRowData = false;
+};
+
+/** Project-wide settings of the native gameplay tag generator. */
+UCLASS(config = Editor, defaultconfig, meta = (DisplayName = "Gameplay Tags Generator"))
+class DATATABLEGAMEPLAYTAGEDITOR_API UDataTableGameplayTagEditorSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	/** Tables regenerated by the GenerateNativeGameplayTags commandlet and on save; the generator tab adds the tables it generates. */
+	UPROPERTY(config, EditAnywhere, Category = "Generator")
+	TArray<FNativeTagGenEntry> GeneratedTables;
+
+	/** Regenerates the files of a listed table in the background after it is saved in the editor. */
+	UPROPERTY(config, EditAnywhere, Category = "Generator")
+	bool bRegenerateOnSave = true;
+
+	/** Seconds to wait after the last save of a table before regenerating it. */
+	UPROPERTY(config, EditAnywhere, Category = "Generator", meta = (ClampMin = "0", Units = "s", EditCondition = "bRegenerateOnSave"))
+	float RegenerateDelay = 2.f;
+
+	/** Cooks a minimal perfect hash with every table whose row names are all gameplay tags. */
+	UPROPERTY(config, EditAnywhere, Category = "Runtime")
+	bool bCookPerfectHash = true;
+
+	/** Entry of a table, or null if it is not listed. */
+	const FNativeTagGenEntry* FindEntry(const FSoftObjectPath& Table) const;
+
+	/** Adds or replaces the entry of its table and saves the project settings. */
+	void RememberEntry(const FNativeTagGenEntry& Entry);
+};
@@ -0,0 +1,233 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataTableGameplayTagEditorSettings.h"
+
+class UDataTable;
+
+/**
+ * A generated file, kept as independently formatted chunks so large outputs can be
+ * built in parallel and streamed to disk without ever concatenating one huge string.
+ */
+struct FGeneratedTagFile
+{
+	/** Absolute path the file is written to. */
+	FString Path;
+
+	/** File contents, in order. */
+	TArray<FString> Chunks;
+
+	/** Joins all chunks; only meant for previews. */
+	FString ToString() const;
+};
+
+/** Rows of a table whose fields are all POD-compatible, read from the table for the row data header. */
+struct FTagGenRowData
+{
+	/** Row names, in row map order. */
+	TArray<FName> RowNames;
+
+	/** C++ type and identifier of each baked field. */
+	TArray<FString> FieldTypes;
+	TArray<FString> FieldNames;
+
+	/** Brace-enclosed constexpr initializer of each row. */
+	TArray<FString> Initializers;
+
+	/** FDataTableTagRowDataBinding checksum of the rows. */
+	uint32 Checksum = 0;
+};
+
+/** Inputs of a generation run. */
+struct FTagGenSettings
+{
+	/** Namespace wrapping the generated tags. */
+	FString Namespace;
+
+	/** Source directory of the module receiving the files. */
+	FString ModuleSourcePath;
+
+	/** Optional sub-folder below Public/Private. */
+	FString RelPath;
+
+	/** File name without extension. */
+	FString FileStem;
+
+	/** How tags are split across files. */
+	ETagGenSharding Sharding = ETagGenSharding::None;
+
+	/** Tags per shard when sharding by count. */
+	int32 TagsPerShard = 1000;
+
+	/** How the generated source registers its tags. */
+	ETagGenRegistration Registration = ETagGenRegistration::PerTagObjects;
+
+	/** Also writes <FileStem>Hierarchy.h with constexpr parent and subtree arrays. */
+	bool bEmitHierarchy = false;
+
+	/** Also writes <FileStem>Rows.h with a row index constant per row of the table. */
+	bool bEmitRowIndex = false;
+
+	/** Also writes <FileStem>Data.h with every row baked into a constexpr array. */
+	bool bEmitRowData = false;
+
+	/** Object path of the source table, embedded in the row index and row data headers. */
+	FString TablePath;
+
+	/** Rows baked into the row data header; gathered from the table when generating from one. */
+	TSharedPtr<const FTagGenRowData> RowData;
+};
+
+/** Tags and their implicit parents, in pre-order: every subtree is the contiguous range [Node, SubtreeEnds[Node]). */
+struct FGameplayTagHierarchy
+{
+	TArray<FName> Nodes;
+
+	/** Index of each node's parent, INDEX_NONE for roots. */
+	TArray<int32> Parents;
+
+	/** One past the last node of each node's subtree. */
+	TArray<int32> SubtreeEnds;
+};
+
+/** A group of tags written to its own header/source pair. */
+struct FTagGenShard
+{
+	/** Suffix appended to the file stem. */
+	FString Name;
+
+	/** Tags of the shard, in row order. */
+	TArray<FName> Tags;
+};
+
+/** Outcome of a generation run. */
+struct FTagGenResult
+{
+	/** Files whose content changed and were rewritten. */
+	TArray<FString> WrittenFiles;
+
+	/** Files left untouched because their content on disk already matched. */
+	TArray<FString> UnchangedFiles;
+
+	/** Tags not present in the previously generated source. */
+	TArray<FName> AddedTags;
+
+	/** Tags of the previously generated source that are gone. */
+	TArray<FName> RemovedTags;
+
+	/** Previously generated files that are no longer part of the output. */
+	TArray<FString> DeletedFiles;
+
+	/** True when nothing had to be written, so no rebuild will be triggered. */
+	bool IsUpToDate() const { return WrittenFiles.Num() == 0 && DeletedFiles.Num() == 0; }
+};
+
+/** Backend shared by every front-end of the native gameplay tag generator. */
+class FGameplayTagCodeGenerator
+{
+public:
+	/** Number of rows formatted by a single parallel task. */
+	static constexpr int32 RowsPerChunk = 2048;
+
+	/** First line of every generated file; only files carrying it are ever deleted as stale. */
+	static const TCHAR* GeneratedMarker;
+
+	/** File stem suffixes of the companion headers. */
+	static const TCHAR* HierarchySuffix;
+	static const TCHAR* RowIndexSuffix;
+	static const TCHAR* RowDataSuffix;
+
+	/** Collects the tags of a table in row order: the Tag of FGameplayTagTableRow rows, otherwise the row names. */
+	static void GatherTags(const UDataTable& Table, TArray<FName>& OutTags, int32 MaxTags = MAX_int32);
+
+	/** Formats the header declaring every tag. */
+	static void BuildHeader(TConstArrayView<FName> Tags, const FTagGenSettings& Settings, FGeneratedTagFile& OutHeader);
+
+	/** Formats the source defining every tag. */
+	static void BuildSource(TConstArrayView<FName> Tags, const FTagGenSettings& Settings, const FString& HeaderInclude, FGeneratedTagFile& OutSource);
+
+	/** Formats header and source together, spreading the chunks of both files over the task graph. */
+	static void BuildFiles(TConstArrayView<FName> Tags, const FTagGenSettings& Settings, const FString& HeaderInclude, FGeneratedTagFile& OutHeader, FGeneratedTagFile& OutSource);
+
+	/** Splits tags into shards, sorted by shard name. */
+	static void SplitShards(TConstArrayView<FName> Tags, ETagGenSharding Sharding, int32 TagsPerShard, TArray<FTagGenShard>& OutShards);
+
+	/**
+	 * Formats every file of a run: a header/source pair, or an umbrella header plus one pair per shard,
+	 * followed by the hierarchy header when enabled.
+	 */
+	static void BuildOutputs(TConstArrayView<FName> Tags, const FTagGenSettings& Settings, TArray<FGeneratedTagFile>& OutFiles);
+
+	/** Numbers the tags and all their parents in pre-order and computes each node's parent and subtree end. */
+	static void BuildHierarchy(TConstArrayView<FName> Tags, FGameplayTagHierarchy& OutHierarchy);
+
+	/** Collects the row names of a table in row map order, which is the order of FDataTableTagIndex. */
+	static void GatherRowNames(const UDataTable& Table, TArray<FName>& OutRowNames);
+
+	/** Formats the row index header of a tag-keyed table; Settings.TablePath must be set. */
+	static void BuildRowIndex(TConstArrayView<FName> RowNames, const FTagGenSettings& Settings, FGeneratedTagFile& OutFile);
+
+	/**
+	 * Reads the rows of a table for the row data header, flattened if the table inherits along the tag hierarchy.
+	 * Logs and returns false if the table is empty or a field is not a bool, number or enum.
+	 */
+	static bool GatherRowData(const UDataTable& Table, FTagGenRowData& OutRowData);
+
+	/** Formats the row data header; Settings.TablePath and Settings.RowData must be set. */
+	static void BuildRowData(const FTagGenSettings& Settings, FGeneratedTagFile& OutFile);
+
+	/** Path of a companion header such as the hierarchy, next to the tag header. */
+	static FString ComputeCompanionPath(const FTagGenSettings& Settings, const TCHAR* Suffix);
+
+	/** Lists the files a previous run may have left for these settings, in either sharded or unsharded form. */
+	static void FindPreviousOutputs(const FTagGenSettings& Settings, TArray<FString>& OutFiles);
+
+	/**
+	 * Generates and writes the files for a table. Files whose content already matches what is on disk are left
+	 * untouched so their timestamps, and therefore the includers' build state, are preserved.
+	 */
+	static bool Generate(const UDataTable& Table, const FTagGenSettings& Settings, FTagGenResult& OutResult);
+
+	/**
+	 * Same as above from tags and row names gathered beforehand, so the run does not touch the table and can
+	 * happen on any thread. Settings.TablePath must be set when the row index is enabled, and Settings.RowData
+	 * when the row data is. Logs and writes nothing if two names would generate the same enumerator.
+	 */
+	static bool Generate(TConstArrayView<FName> Tags, TConstArrayView<FName> RowNames, const FTagGenSettings& Settings, FTagGenResult& OutResult);
+
+	/** Resolves a stored generator entry into run settings; logs and returns false if it is incomplete. */
+	static bool MakeSettings(const FNativeTagGenEntry& Entry, FTagGenSettings& OutSettings);
+
+	/** Logs the tags and files a run added, removed, skipped or deleted. */
+	static void LogResult(const FTagGenResult& Result);
+
+	/** Streams a generated file to disk as UTF-8, creating its directory if needed. */
+	static bool WriteFile(const FGeneratedTagFile& File);
+
+	/** Writes the file only if its content hash or size differs from the file on disk. */
+	static bool WriteFileIfChanged(const FGeneratedTagFile& File, bool& bOutWritten);
+
+	/** Compares the UTF-8 encoded content of a generated file with the file on disk. */
+	static bool MatchesFileOnDisk(const FGeneratedTagFile& File);
+
+	/** Appends the tags defined by a previously generated source file. */
+	static void ReadGeneratedTags(const FString& SourcePath, TArray<FName>& OutTags);
+
+	/** Finds the source directory of a project or project plugin module by name. */
+	static bool FindModuleSourcePath(const FString& ModuleName, FString& OutModuleSourcePath);
+
+	/** Resolves the Public header and Private source paths for a module. */
+	static void ComputeOutputPaths(const FString& ModuleSourcePath, const FString& RelPath, const FString& FileStem, FString& OutHeader, FString& OutSource);
+
+	/** Include path of the generated header as seen from the generated source. */
+	static FString ComputeHeaderInclude(const FString& RelPath, const FString& FileStem);
+
+	/** Appends the C++ identifier of a tag (dots replaced by underscores) without a temporary string. */
+	static void AppendIdentifier(FString& Out, FName Tag);
+
+private:
+	/** Tag header/source files of BuildOutputs. */
+	static void BuildTagOutputs(TConstArrayView<FName> Tags, const FTagGenSettings& Settings, TArray<FGeneratedTagFile>& OutFiles);
+};
@@ -0,0 +1,35 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "GenerateNativeGameplayTagsCommandlet.generated.h"
+
+struct FNativeTagGenEntry;
+
+/**
+ * Regenerates native gameplay tag files without the editor UI.
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=GenerateNativeGameplayTags [-Config=<Entries.json>]
+ *
+ * Entries come from the Gameplay Tags Generator project settings, or from a JSON array of
+ * { "Table", "Module", "RelPath", "Namespace", "FileStem" } objects when -Config is given.
+ * Tables are processed in parallel and unchanged files are left untouched.
+ */
+UCLASS()
+class UGenerateNativeGameplayTagsCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGenerateNativeGameplayTagsCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+private:
+	static bool LoadEntries(const FString& ConfigPath, TArray<FNativeTagGenEntry>& OutEntries);
+};
@@ -7,9 +7,10 @@
 #include "GameProjectUtils.h"
 #include "Templates/SharedPointer.h"
 #include "Input/Reply.h"
+#include "GameplayTagCodeGenerator.h"
+#include "Widgets/Views/SListView.h"
 
 class SEditableTextBox;
-struct FGameplayTagTableRow;
 struct FModuleContextInfo;
 
 class STagGenWidget : public SCompoundWidget
@@ -24,20 +25,37 @@ private:
 	// UI callbacks
 	FReply OnGenerateClicked();
 	FReply OnChooseFolderClicked();
+	FReply OnExportBlobClicked();
 	TSharedRef<SWidget> MakeDataTablePicker();
 	TSharedRef<SWidget> MakeModuleCombo();
-	bool CanGenerate() const;
-	FText GetPathPreviewText() const;
-	FText GetHeaderPreviewText() const;
-	FText GetSourcePreviewText() const;
-	FText GetErrorMessage() const;
+	TSharedRef<SWidget> MakeShardingCombo();
+	TSharedRef<ITableRow> MakePreviewLineRow(TSharedPtr<FString> Line, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnSourceTableSelected(UDataTable* Table);
+
+	// Cached state shown by the widgets; recomputed when an input changes rather than on every paint
+	bool CanGenerate() const { return bCanGenerate; }
+	FText GetPathPreviewText() const { return PathPreview; }
+	FText GetHeaderPreviewText() const { return HeaderPreview; }
+	FText GetSourcePreviewText() const { return SourcePreview; }
+	FText GetErrorMessage() const { return ErrorMessage; }
+
+	/** Recomputes the cached validation and short previews, and schedules the full preview. */
+	void RefreshPreview();
+
+	/** Rebuilds the full preview once inputs have settled. */
+	EActiveTimerReturnType RefreshFullPreview(double InCurrentTime, float InDeltaTime);
+	
+	FText ValidateInputs() const;
+	FText BuildPathPreview() const;
 	
 	// Helpers
-	bool WriteFiles();
-	static FString SafeName(const FName& Tag);
-	static FString BuildHeader(const TArray<FGameplayTagTableRow*>& Rows, const FString& NS);
-	static FString BuildSource(const TArray<FGameplayTagTableRow*>& Rows, const FString& NS, const FString& HeaderPathWithExt);
+	bool WriteFiles(FTagGenResult& OutResult);
+	FTagGenSettings MakeSettings() const;
+	FNativeTagGenEntry MakeEntry() const;
+	void ApplyEntry(const FNativeTagGenEntry& Entry);
 	void ComputeOutputPaths(FString& OutHeader, FString& OutSource) const;
+	FString ComputeHeaderInclude() const;
+	void GatherPreviewTags(TArray<FName>& OutTags) const;
 	
 	// Inputs
 	TSoftObjectPtr<UDataTable> SourceTable;
@@ -48,4 +66,35 @@ private:
 	TArray<TSharedPtr<FModuleContextInfo>> Modules;
 	TSharedPtr<FModuleContextInfo> SelectedModule;
 	FString RelPath; // relative to Public/Private
+
+	// Output splitting
+	TArray<TSharedPtr<ETagGenSharding>> ShardingOptions;
+	ETagGenSharding Sharding = ETagGenSharding::None;
+	int32 TagsPerShard = 1000;
+
+	// Registration
+	bool bBulkRegistration = false;
+
+	// Hierarchy header
+	bool bEmitHierarchy = false;
+
+	// Row index header
+	bool bEmitRowIndex = false;
+
+	// Row data header
+	bool bEmitRowData = false;
+
+	// Cached previews
+	bool bCanGenerate = false;
+	FText ErrorMessage;
+	FText PathPreview;
+	FText HeaderPreview;
+	FText SourcePreview;
+	FDelegateHandle TableChangedHandle;
+
+	// Full preview, one list item per line so only visible lines are laid out
+	bool bFullPreview = false;
+	TArray<TSharedPtr<FString>> PreviewLines;
+	TSharedPtr<SListView<TSharedPtr<FString>>> PreviewList;
+	TSharedPtr<FActiveTimerHandle> FullPreviewTimer;
 };
@@ -0,0 +1,25 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UDataTable;
+
+/**
+ * Exports tag-keyed data tables to the memory-mappable format of TagTableBlob.h, for tools that read balance
+ * data without the engine. Numeric, bool and enum fields become fixed-layout row fields; strings, names, texts
+ * and gameplay tags go to the string pool. Any other field (arrays, nested structs, objects) is skipped.
+ */
+class FTagTableBlobExporter
+{
+public:
+	/** Builds the blob of a table; fails on an empty row struct or if the perfect hash cannot be built. */
+	static bool Export(const UDataTable& Table, TArray<uint8>& OutBlob, FString& OutError);
+
+	/** Reads every row back through the standalone reader and compares each exported field with the table. */
+	static bool Verify(const UDataTable& Table, TConstArrayView<uint8> Blob, FString& OutError);
+
+	/** Exports, verifies and saves a table. */
+	static bool ExportToFile(const UDataTable& Table, const FString& Path, FString& OutError);
+};
@@ -0,0 +1,68 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UDataTable;
+class UScriptStruct;
+
+/** A problem found while importing one row or column. */
+struct FTagTableImportIssue
+{
+	/** Line of the CSV record, or position of the JSON row object; 0 for the whole file. */
+	int32 Line = 0;
+
+	FName RowName;
+
+	FString Message;
+};
+
+/** Outcome of an import. */
+struct FTagTableImportResult
+{
+	/** Rows now in the table. */
+	int32 NumRows = 0;
+
+	/** Row keys that are not registered gameplay tags; the rows are imported anyway. */
+	int32 NumInvalidTags = 0;
+
+	/** Every problem of the import, sorted by line. */
+	TArray<FTagTableImportIssue> Issues;
+
+	/** Checksum of the index built for the imported rows. */
+	uint32 Checksum = 0;
+
+	/** False when the row struct references objects and values had to be assigned on the game thread. */
+	bool bParallelAssign = false;
+
+	double ParseSeconds = 0.0;
+	double AssignSeconds = 0.0;
+
+	/** One line per issue, at most MaxIssues of them, followed by a summary. */
+	FString MakeReport(int32 MaxIssues = 100) const;
+};
+
+/**
+ * Imports CSV or JSON into a tag-keyed table. Records are parsed and their keys validated against the registered
+ * gameplay tags in parallel chunks, then values are assigned to the rows in parallel when the row struct allows
+ * it, and the row index is rebuilt before returning. All problems end up in a single report instead of the log.
+ */
+class FTagTableImporter
+{
+public:
+	/** Records handled by a single parallel task. */
+	static constexpr int32 RecordsPerTask = 1024;
+
+	/** Imports the CSV format of the engine's table exporter: a header row of property names, the row name first. */
+	static bool ImportCsv(UDataTable& Table, const FString& Csv, FTagTableImportResult& OutResult);
+
+	/** Imports the JSON format of the engine's table exporter: an array of row objects with a Name field. */
+	static bool ImportJson(UDataTable& Table, const FString& Json, FTagTableImportResult& OutResult);
+
+	/** Imports a .csv or .json file. */
+	static bool ImportFile(UDataTable& Table, const FString& Path, FTagTableImportResult& OutResult);
+
+	/** True if values of the struct can be imported off the game thread, i.e. it references no objects. */
+	static bool CanAssignInParallel(const UScriptStruct& Struct);
+};
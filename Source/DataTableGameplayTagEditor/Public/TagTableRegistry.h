@@ -0,0 +1,54 @@
+﻿// Copyright 2025 Marco Santini. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FAssetData;
+
+/**
+ * Project-wide reverse index from row tags to the tag-keyed tables containing them, built from the asset
+ * registry tags of FDataTableTagAssetTags so no table has to be loaded. Kept up to date as assets are added,
+ * saved, renamed and removed. Tables saved before the tags existed are unknown until saved again.
+ */
+class DATATABLEGAMEPLAYTAGEDITOR_API FTagTableRegistry
+{
+public:
+	static FTagTableRegistry& Get();
+
+	/** Releases the index and its asset registry subscriptions. */
+	static void Shutdown();
+
+	~FTagTableRegistry();
+
+	/** Tag-keyed tables with a row named RowName. */
+	void FindTablesWithRow(FName RowName, TArray<FSoftObjectPath>& OutTables);
+
+	/** Row names of a tag-keyed table as last saved; false if the table is unknown. */
+	bool GetRowNames(const FSoftObjectPath& Table, TArray<FName>& OutRowNames);
+
+	/**
+	 * Whether a table has a row. A table already in memory answers from its current rows, any other from the
+	 * index; unset if the table is neither loaded nor known.
+	 */
+	TOptional<bool> HasRow(const FSoftObjectPath& Table, FName RowName);
+
+	/** Number of tag-keyed tables known. */
+	int32 NumTables();
+
+private:
+	FTagTableRegistry() = default;
+
+	void Build();
+	void AddAsset(const FAssetData& Asset);
+	void RemoveTable(const FSoftObjectPath& Table);
+	void OnAssetRenamed(const FAssetData& Asset, const FString& OldObjectPath);
+
+	bool bBuilt = false;
+	TMap<FSoftObjectPath, TArray<FName>> RowsByTable;
+	TMultiMap<FName, FSoftObjectPath> TablesByRow;
+	FDelegateHandle AddedHandle;
+	FDelegateHandle UpdatedHandle;
+	FDelegateHandle RemovedHandle;
+	FDelegateHandle RenamedHandle;
+};
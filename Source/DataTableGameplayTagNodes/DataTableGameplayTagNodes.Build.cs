@@ -25,6 +25,7 @@ public class DataTableGameplayTagNodes : ModuleRules
                 "KismetCompiler",
                 "GameplayTags",
                 "DataTableGameplayTag",
+                "DataTableGameplayTagEditor",
             }
         );
     }
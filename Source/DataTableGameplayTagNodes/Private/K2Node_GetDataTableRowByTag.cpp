@@ -1,4 +1,4 @@
-// Copyright 2023 Marco Santini. All rights reserved.
+﻿// Copyright 2023 Marco Santini. All rights reserved.
 
 #include "K2Node_GetDataTableRowByTag.h"
 
@@ -15,6 +15,7 @@
 #include "EdGraphSchema_K2.h"
 #include "EditorCategoryUtils.h"
 #include "GameplayTagContainer.h"
+#include "GameplayTagDataTable.h"
 #include "Engine/DataTable.h"
 #include "Engine/MemberReference.h"
 #include "HAL/PlatformMath.h"
@@ -28,6 +29,7 @@
 #include "Math/Color.h"
 #include "Misc/AssertionMacros.h"
 #include "Styling/AppStyle.h"
+#include "TagTableRegistry.h"
 #include "Templates/Casts.h"
 #include "Templates/ChooseClass.h"
 #include "UObject/Class.h"
@@ -48,12 +50,37 @@ namespace GetDataTableRowByTagHelper
 	const FName DataTablePinName = "DataTable";
 	const FName RowNotFoundPinName = "RowNotFound";
 	const FName TagPinName = "Tag";
+
+	/** True for the table types the node reads from: data tables and gameplay tag data tables. */
+	static bool IsTableClass(const UClass* Class)
+	{
+		return Class && (Class->IsChildOf(UDataTable::StaticClass()) || Class->IsChildOf(UGameplayTagDataTable::StaticClass()));
+	}
+
+	/** Class of the table reaching the pin: the type of the connected pin, otherwise the class of the literal. */
+	static UClass* GetTableClass(const UEdGraphPin& DataTablePin)
+	{
+		if (DataTablePin.LinkedTo.Num() > 0)
+		{
+			return Cast<UClass>(DataTablePin.LinkedTo[0]->PinType.PinSubCategoryObject.Get());
+		}
+		return DataTablePin.DefaultObject ? DataTablePin.DefaultObject->GetClass() : nullptr;
+	}
+
+	/** Tag name of an unconnected tag pin, from its default value (TagName="...") */
+	static FName GetDefaultTagName(const UEdGraphPin& TagPin)
+	{
+		FString DefaultString = TagPin.GetDefaultAsString();
+		DefaultString.RemoveFromStart(TEXT("(TagName=\""));
+		DefaultString.RemoveFromEnd(TEXT("\")"));
+		return FName(*DefaultString);
+	}
 }
 
 UK2Node_GetDataTableRowByTag::UK2Node_GetDataTableRowByTag(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	NodeTooltip = LOCTEXT("NodeTooltip", "Attempts to retrieve a TableRow from a DataTable using a GameplayTag as the RowName.");
+	NodeTooltip = LOCTEXT("NodeTooltip", "Attempts to retrieve a TableRow from a DataTable using a GameplayTag as the RowName, or from a GameplayTagDataTable using the tag itself.");
 }
 
 void UK2Node_GetDataTableRowByTag::AllocateDefaultPins()
@@ -64,9 +91,9 @@ void UK2Node_GetDataTableRowByTag::AllocateDefaultPins()
 	RowFoundPin->PinFriendlyName = LOCTEXT("GetDataTableRow Row Found Exec pin", "Row Found");
 	CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, GetDataTableRowByTagHelper::RowNotFoundPinName);
 
-	// Add DataTable pin
-	UEdGraphPin* DataTablePin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Object, UDataTable::StaticClass(), GetDataTableRowByTagHelper::DataTablePinName);
-	SetPinToolTip(*DataTablePin, LOCTEXT("DataTablePinDescription", "The DataTable you want to retreive a row from"));
+	// Add DataTable pin; either table type is accepted, see IsConnectionDisallowed
+	UEdGraphPin* DataTablePin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Object, UObject::StaticClass(), GetDataTableRowByTagHelper::DataTablePinName);
+	SetPinToolTip(*DataTablePin, LOCTEXT("DataTablePinDescription", "The DataTable or GameplayTagDataTable you want to retreive a row from"));
 
 	// Tag pin
 	UEdGraphPin* TagPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Struct, FGameplayTag::StaticStruct(), GetDataTableRowByTagHelper::TagPinName);
@@ -80,6 +107,17 @@ void UK2Node_GetDataTableRowByTag::AllocateDefaultPins()
 	Super::AllocateDefaultPins();
 }
 
+FString UK2Node_GetDataTableRowByTag::GetPinMetaData(FName InPinName, FName InKey)
+{
+	// The pin is typed UObject to take both table types, so the literal's asset picker is narrowed here
+	static const FName AllowedClassesKey(TEXT("AllowedClasses"));
+	if (InPinName == GetDataTableRowByTagHelper::DataTablePinName && InKey == AllowedClassesKey)
+	{
+		return UDataTable::StaticClass()->GetClassPathName().ToString() + TEXT(",") + UGameplayTagDataTable::StaticClass()->GetClassPathName().ToString();
+	}
+	return Super::GetPinMetaData(InPinName, InKey);
+}
+
 void UK2Node_GetDataTableRowByTag::SetPinToolTip(UEdGraphPin& MutatablePin, const FText& PinDescription) const
 {
 	MutatablePin.PinToolTip = UEdGraphSchema_K2::TypeToText(MutatablePin.PinType).ToString();
@@ -146,6 +184,10 @@ UScriptStruct* UK2Node_GetDataTableRowByTag::GetDataTableRowStructType() const
 		{
 			RowStructType = DataTable->RowStruct;
 		}
+		else if (const UGameplayTagDataTable* TagTable = Cast<const UGameplayTagDataTable>(DataTablePin->DefaultObject))
+		{
+			RowStructType = const_cast<UScriptStruct*>(TagTable->GetRowStruct());
+		}
 	}
 
 	if (RowStructType == nullptr)
@@ -181,7 +223,7 @@ void UK2Node_GetDataTableRowByTag::OnDataTableRowListChanged(const UDataTable* D
 		UEdGraphPin* TagPin = GetTagPin();
 		const bool TryRefresh = TagPin && !TagPin->LinkedTo.Num();
 		const FName CurrentName = TagPin ? FName(*TagPin->GetDefaultAsString()) : NAME_None;
-		if (TryRefresh && TagPin && !DataTable->GetRowNames().Contains(CurrentName))
+		if (TryRefresh && TagPin && !FTagTableRegistry::Get().HasRow(FSoftObjectPath(DataTable), CurrentName).Get(true))
 		{
 			if (UBlueprint* BP = GetBlueprint())
 			{
@@ -197,11 +239,11 @@ void UK2Node_GetDataTableRowByTag::ReallocatePinsDuringReconstruction(TArray<UEd
 
 	if (UEdGraphPin* DataTablePin = GetDataTablePin(&OldPins))
 	{
-		if (UDataTable* DataTable = Cast<UDataTable>(DataTablePin->DefaultObject))
+		if (DataTablePin->DefaultObject && GetDataTableRowByTagHelper::IsTableClass(DataTablePin->DefaultObject->GetClass()))
 		{
 			// make sure to properly load the data-table object so that we can 
 			// farm the "RowStruct" property from it (below, in GetDataTableRowStructType)
-			PreloadObject(DataTable);
+			PreloadObject(DataTablePin->DefaultObject);
 		}
 	}
 }
@@ -254,6 +296,15 @@ bool UK2Node_GetDataTableRowByTag::IsConnectionDisallowed(const UEdGraphPin* MyP
 		}
 		return bDisallowed;
 	}
+	if (MyPin == GetDataTablePin())
+	{
+		const UClass* ConnectionClass = Cast<UClass>(OtherPin->PinType.PinSubCategoryObject.Get());
+		if (OtherPin->PinType.PinCategory != UEdGraphSchema_K2::PC_Object || !GetDataTableRowByTagHelper::IsTableClass(ConnectionClass))
+		{
+			OutReason = TEXT("Must be a DataTable or a GameplayTagDataTable");
+			return true;
+		}
+	}
 	return false;
 }
 
@@ -265,6 +316,7 @@ void UK2Node_GetDataTableRowByTag::PinDefaultValueChanged(UEdGraphPin* ChangedPi
 
 		UEdGraphPin* TagPin = GetTagPin();
 		UDataTable*  DataTable = Cast<UDataTable>(ChangedPin->DefaultObject);
+		const UGameplayTagDataTable* TagTable = Cast<UGameplayTagDataTable>(ChangedPin->DefaultObject);
 		if (TagPin)
 		{
 			if (DataTable && (TagPin->DefaultValue.IsEmpty() || !DataTable->GetRowMap().Contains(*TagPin->DefaultValue)))
@@ -273,7 +325,15 @@ void UK2Node_GetDataTableRowByTag::PinDefaultValueChanged(UEdGraphPin* ChangedPi
 				{
 					TagPin->DefaultValue = Iterator.Key().ToString();
 				}
-			}	
+			}
+			else if (TagTable && TagTable->Num() > 0)
+			{
+				const FGameplayTag CurrentTag = FGameplayTag::RequestGameplayTag(GetDataTableRowByTagHelper::GetDefaultTagName(*TagPin), /*ErrorIfNotFound*/false);
+				if (TagTable->IndexOf(CurrentTag) == INDEX_NONE)
+				{
+					TagPin->DefaultValue = FString::Printf(TEXT("(TagName=\"%s\")"), *TagTable->GetRowTag(0).ToString());
+				}
+			}
 
 			RefreshRowNameOptions();
 		}
@@ -361,17 +421,19 @@ void UK2Node_GetDataTableRowByTag::ExpandNode(class FKismetCompilerContext& Comp
     Super::ExpandNode(CompilerContext, SourceGraph);
     
     UEdGraphPin* OriginalDataTableInPin = GetDataTablePin();
-    UDataTable* Table = (OriginalDataTableInPin != NULL) ? Cast<UDataTable>(OriginalDataTableInPin->DefaultObject) : NULL;
-    if((nullptr == OriginalDataTableInPin) || (0 == OriginalDataTableInPin->LinkedTo.Num() && nullptr == Table))
+    const UClass* TableClass = (OriginalDataTableInPin != NULL) ? GetDataTableRowByTagHelper::GetTableClass(*OriginalDataTableInPin) : NULL;
+    if((nullptr == OriginalDataTableInPin) || !GetDataTableRowByTagHelper::IsTableClass(TableClass))
     {
-        CompilerContext.MessageLog.Error(*LOCTEXT("GetDataTableRowByTagNoDataTable_Error", "GetDataTableRowByTag must have a DataTable specified.").ToString(), this);
+        CompilerContext.MessageLog.Error(*LOCTEXT("GetDataTableRowByTagNoDataTable_Error", "GetDataTableRowByTag must have a DataTable or a GameplayTagDataTable specified.").ToString(), this);
         // we break exec links so this is the only error we get
         BreakAllNodeLinks();
         return;
     }
 
 	// FUNCTION NODE
-	const FName FunctionName = GET_FUNCTION_NAME_CHECKED(UDataTableGameplayTagFunctionLibrary, GetDataTableRowByTag);
+	const FName FunctionName = TableClass->IsChildOf(UGameplayTagDataTable::StaticClass())
+		? GET_FUNCTION_NAME_CHECKED(UDataTableGameplayTagFunctionLibrary, GetGameplayTagDataTableRow)
+		: GET_FUNCTION_NAME_CHECKED(UDataTableGameplayTagFunctionLibrary, GetDataTableRowByTag);
 	UK2Node_CallFunction* GetDataTableRowByTagFunction = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
 	GetDataTableRowByTagFunction->FunctionReference.SetExternalMember(FunctionName, UDataTableGameplayTagFunctionLibrary::StaticClass());
 	GetDataTableRowByTagFunction->AllocateDefaultPins();
@@ -457,29 +519,33 @@ void UK2Node_GetDataTableRowByTag::EarlyValidation(class FCompilerResultsLog& Me
 
 	if (DataTablePin->LinkedTo.Num() == 0)
 	{
-		const UDataTable* DataTable = Cast<UDataTable>(DataTablePin->DefaultObject);
-		if (!DataTable)
+		const UObject* Table = DataTablePin->DefaultObject;
+		if (!Table || !GetDataTableRowByTagHelper::IsTableClass(Table->GetClass()))
 		{
-			MessageLog.Error(*LOCTEXT("NoDataTable", "No DataTable in @@").ToString(), this);
+			MessageLog.Error(*LOCTEXT("NoDataTable", "No DataTable or GameplayTagDataTable in @@").ToString(), this);
 			return;
 		}
 
 		if (!RowNamePin->LinkedTo.Num())
 		{
-			// Sanitize the string
-			// Basically we want to remove (TagName=" and ") from the string and get the tag real name
-			FString DefaultString = RowNamePin->GetDefaultAsString();
-			DefaultString.RemoveFromStart(TEXT("(TagName=\""));
-			DefaultString.RemoveFromEnd(TEXT("\")"));
-
-			const FName CurrentName = FName(*DefaultString);
-			
-			if (!DataTable->GetRowNames().Contains(CurrentName))
+			const FName CurrentName = GetDataTableRowByTagHelper::GetDefaultTagName(*RowNamePin);
+
+			bool bHasRow;
+			if (const UGameplayTagDataTable* TagTable = Cast<UGameplayTagDataTable>(Table))
+			{
+				bHasRow = TagTable->IndexOf(FGameplayTag::RequestGameplayTag(CurrentName, /*ErrorIfNotFound*/false)) != INDEX_NONE;
+			}
+			else
+			{
+				bHasRow = FTagTableRegistry::Get().HasRow(FSoftObjectPath(Table), CurrentName).Get(true);
+			}
+
+			if (!bHasRow)
 			{
 				const FString Msg = FText::Format(
 					LOCTEXT("WrongRowNameFmt", "The tag '{0}' is not stored in '{1}'. @@"),
 					FText::FromString(CurrentName.ToString()),
-					FText::FromString(GetFullNameSafe(DataTable))
+					FText::FromString(GetFullNameSafe(Table))
 				).ToString();
 				MessageLog.Error(*Msg, this);
 				return;
@@ -492,11 +558,11 @@ void UK2Node_GetDataTableRowByTag::PreloadRequiredAssets()
 {
 	if (UEdGraphPin* DataTablePin = GetDataTablePin())
 	{
-		if (UDataTable* DataTable = Cast<UDataTable>(DataTablePin->DefaultObject))
+		if (DataTablePin->DefaultObject && GetDataTableRowByTagHelper::IsTableClass(DataTablePin->DefaultObject->GetClass()))
 		{
 			// make sure to properly load the data-table object so that we can 
 			// farm the "RowStruct" property from it (below, in GetDataTableRowStructType)
-			PreloadObject(DataTable);
+			PreloadObject(DataTablePin->DefaultObject);
 		}
 	}
 	return Super::PreloadRequiredAssets();
@@ -1,4 +1,4 @@
-// Copyright 2023 Marco Santini. All rights reserved.
+﻿// Copyright 2023 Marco Santini. All rights reserved.
 
 #pragma once
 
@@ -37,6 +37,7 @@ class DATATABLEGAMEPLAYTAGNODES_API UK2Node_GetDataTableRowByTag : public UK2Nod
 	virtual void ExpandNode(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
 	virtual FSlateIcon GetIconAndTint(FLinearColor& OutColor) const override;
 	virtual void PostReconstructNode() override;
+	virtual FString GetPinMetaData(FName InPinName, FName InKey) override;
 	//~ End UEdGraphNode Interface.
 
 	//~ Begin UK2Node Interface